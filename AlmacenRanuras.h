@@ -0,0 +1,98 @@
+#ifndef ALMACEN_RANURAS_H
+#define ALMACEN_RANURAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Manejador estable a un elemento del almacén: ranura + generación.
+// Sigue identificando al mismo elemento aunque otros se inserten o eliminen;
+// si el elemento se elimina, el manejador deja de ser válido.
+struct Manejador {
+    uint32_t indice;
+    uint32_t generacion;
+
+    static Manejador invalido() { return Manejador{UINT32_MAX, 0}; }
+    bool esValido() const { return indice != UINT32_MAX; }
+
+    bool operator==(const Manejador& otro) const {
+        return indice == otro.indice && generacion == otro.generacion;
+    }
+    bool operator!=(const Manejador& otro) const { return !(*this == otro); }
+    bool operator<(const Manejador& otro) const {
+        return indice != otro.indice ? indice < otro.indice : generacion < otro.generacion;
+    }
+};
+
+// Plantilla AlmacenRanuras - Vector generacional (slot map)
+// Los valores viven contiguos en un std::vector. Las ranuras liberadas se
+// reutilizan (lista de libres) y su generación aumenta, de modo que los
+// manejadores viejos se detectan como inválidos. Generación impar = ocupada.
+template <typename T>
+class AlmacenRanuras {
+private:
+    std::vector<T> valores;
+    std::vector<uint32_t> generaciones;
+    std::vector<uint32_t> libres;
+    size_t ocupadas;
+
+public:
+    AlmacenRanuras() : ocupadas(0) {}
+
+    // Reservar capacidad para n elementos en total
+    void reservar(size_t n) {
+        valores.reserve(n);
+        generaciones.reserve(n);
+    }
+
+    // Insertar un valor y devolver su manejador (O(1) amortizado)
+    Manejador insertar(T valor) {
+        uint32_t indice;
+        if (!libres.empty()) {
+            indice = libres.back();
+            libres.pop_back();
+            valores[indice] = std::move(valor);
+        } else {
+            indice = static_cast<uint32_t>(valores.size());
+            valores.push_back(std::move(valor));
+            generaciones.push_back(0);
+        }
+        generaciones[indice]++;
+        ocupadas++;
+        return Manejador{indice, generaciones[indice]};
+    }
+
+    // Eliminar el elemento; su ranura queda disponible para reutilizarse (O(1))
+    bool eliminar(Manejador manejador) {
+        if (!contiene(manejador)) {
+            return false;
+        }
+        valores[manejador.indice] = T(); // Liberar la memoria que tenga el valor
+        generaciones[manejador.indice]++;
+        libres.push_back(manejador.indice);
+        ocupadas--;
+        return true;
+    }
+
+    bool contiene(Manejador manejador) const {
+        return manejador.indice < generaciones.size() &&
+               generaciones[manejador.indice] == manejador.generacion &&
+               (manejador.generacion & 1) != 0;
+    }
+
+    // Acceso sin verificación (el manejador debe ser válido)
+    T& operator[](Manejador manejador) { return valores[manejador.indice]; }
+    const T& operator[](Manejador manejador) const { return valores[manejador.indice]; }
+
+    // Acceso verificado: nullptr si el manejador ya no es válido
+    T* obtener(Manejador manejador) { return contiene(manejador) ? &valores[manejador.indice] : nullptr; }
+    const T* obtener(Manejador manejador) const {
+        return contiene(manejador) ? &valores[manejador.indice] : nullptr;
+    }
+
+    size_t obtenerTamanio() const { return ocupadas; }
+    size_t obtenerCapacidadRanuras() const { return valores.size(); }
+};
+
+#endif // ALMACEN_RANURAS_H
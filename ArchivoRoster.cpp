@@ -0,0 +1,566 @@
+#include "ArchivoRoster.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ARCHIVO_ROSTER_MMAP 1
+#endif
+
+const char* const CABECERA_CSV_ROSTER =
+    "nombreCompleto,anioNacimiento,numeroIdentificacion,promedioAcademico,email";
+
+// ========== ARCHIVO MAPEADO ==========
+
+// Constructor - proyecta el archivo completo en memoria
+ArchivoMapeado::ArchivoMapeado(const std::string& nombreArchivo) : datos(nullptr), tamanio(0) {
+#ifdef ARCHIVO_ROSTER_MMAP
+    int descriptor = ::open(nombreArchivo.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("No se pudo abrir el archivo " + nombreArchivo);
+    }
+
+    struct stat info;
+    if (::fstat(descriptor, &info) != 0) {
+        ::close(descriptor);
+        throw std::runtime_error("No se pudo leer el tamaño de " + nombreArchivo);
+    }
+
+    tamanio = static_cast<size_t>(info.st_size);
+    if (tamanio > 0) {
+        void* proyeccion = ::mmap(nullptr, tamanio, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (proyeccion == MAP_FAILED) {
+            ::close(descriptor);
+            throw std::runtime_error("No se pudo proyectar el archivo " + nombreArchivo);
+        }
+        ::madvise(proyeccion, tamanio, MADV_SEQUENTIAL);
+        datos = static_cast<const char*>(proyeccion);
+    }
+    ::close(descriptor); // La proyección sigue válida sin el descriptor
+#else
+    std::ifstream archivo(nombreArchivo, std::ios::binary | std::ios::ate);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo " + nombreArchivo);
+    }
+    tamanio = static_cast<size_t>(archivo.tellg());
+    respaldo.resize(tamanio);
+    archivo.seekg(0);
+    archivo.read(respaldo.data(), static_cast<std::streamsize>(tamanio));
+    datos = respaldo.data();
+#endif
+}
+
+// Destructor - libera la proyección
+ArchivoMapeado::~ArchivoMapeado() {
+#ifdef ARCHIVO_ROSTER_MMAP
+    if (datos != nullptr) {
+        ::munmap(const_cast<char*>(datos), tamanio);
+    }
+#endif
+}
+
+// ========== LECTURA CSV ==========
+
+namespace {
+
+// Leer un campo CSV desde 'cursor' hasta la coma o el final de la línea.
+// Devuelve false si las comillas no están balanceadas.
+bool leerCampo(const char*& cursor, const char* fin, std::string& campo) {
+    campo.clear();
+    if (cursor < fin && *cursor == '"') {
+        cursor++;
+        while (cursor < fin) {
+            const char* comilla = static_cast<const char*>(std::memchr(cursor, '"', fin - cursor));
+            if (comilla == nullptr) {
+                return false;
+            }
+            campo.append(cursor, comilla);
+            cursor = comilla + 1;
+            if (cursor < fin && *cursor == '"') {
+                campo.push_back('"'); // Comilla escapada
+                cursor++;
+            } else {
+                break;
+            }
+        }
+        if (cursor < fin && *cursor != ',') {
+            return false;
+        }
+    } else {
+        const char* coma = static_cast<const char*>(std::memchr(cursor, ',', fin - cursor));
+        const char* finCampo = coma != nullptr ? coma : fin;
+        campo.assign(cursor, finCampo);
+        cursor = finCampo;
+    }
+    if (cursor < fin) {
+        cursor++; // Saltar la coma
+    }
+    return true;
+}
+
+// Convertir un campo numérico completo con from_chars
+template <typename T>
+bool convertirNumero(const std::string& texto, T& valor) {
+    const char* inicio = texto.data();
+    const char* fin = inicio + texto.size();
+    while (inicio < fin && *inicio == ' ') inicio++;
+    while (fin > inicio && fin[-1] == ' ') fin--;
+    auto resultado = std::from_chars(inicio, fin, valor);
+    return resultado.ec == std::errc() && resultado.ptr == fin && inicio != fin;
+}
+
+// Invertir 'entreComillas' por cada comilla de [desde, hasta); una comilla
+// escapada ("") lo invierte dos veces y no cambia nada
+bool contarComillas(const char* desde, const char* hasta, bool entreComillas) {
+    const char* comilla = static_cast<const char*>(std::memchr(desde, '"', hasta - desde));
+    while (comilla != nullptr) {
+        entreComillas = !entreComillas;
+        comilla = static_cast<const char*>(std::memchr(comilla + 1, '"', hasta - comilla - 1));
+    }
+    return entreComillas;
+}
+
+// Primer salto de línea de [cursor, fin) que no está dentro de un campo entre
+// comillas, o 'fin' si no hay. 'entreComillas' indica el estado en 'cursor'.
+const char* buscarFinRegistro(const char* cursor, const char* fin, bool entreComillas) {
+    while (true) {
+        const char* salto = static_cast<const char*>(std::memchr(cursor, '\n', fin - cursor));
+        const char* limite = salto != nullptr ? salto : fin;
+        entreComillas = contarComillas(cursor, limite, entreComillas);
+        if (!entreComillas || salto == nullptr) {
+            return limite;
+        }
+        cursor = salto + 1; // El salto es parte del campo
+    }
+}
+
+// Interpretar los registros de [inicio, fin) y agregarlos a 'destino'.
+// Un registro termina en el primer salto de línea fuera de comillas.
+void interpretarTramoCSV(const char* inicio, const char* fin, std::vector<Estudiante>& destino) {
+    std::string campos[5];
+    const size_t largoCabecera = std::strlen(CABECERA_CSV_ROSTER);
+
+    while (inicio < fin) {
+        const char* finLinea = buscarFinRegistro(inicio, fin, false);
+        const char* siguiente = finLinea < fin ? finLinea + 1 : fin;
+        if (finLinea > inicio && finLinea[-1] == '\r') {
+            finLinea--;
+        }
+
+        // Saltar líneas vacías y la cabecera
+        if (finLinea == inicio ||
+            (static_cast<size_t>(finLinea - inicio) >= largoCabecera &&
+             std::memcmp(inicio, CABECERA_CSV_ROSTER, largoCabecera) == 0)) {
+            inicio = siguiente;
+            continue;
+        }
+
+        const char* cursor = inicio;
+        bool valida = true;
+        for (int c = 0; c < 5 && valida; c++) {
+            valida = leerCampo(cursor, finLinea, campos[c]);
+        }
+
+        Estudiante estudiante;
+        valida = valida && cursor == finLinea &&
+                 convertirNumero(campos[1], estudiante.anioNacimiento) &&
+                 convertirNumero(campos[3], estudiante.promedioAcademico);
+        if (!valida) {
+            throw std::runtime_error("Línea CSV mal formada: " + std::string(inicio, finLinea));
+        }
+
+        estudiante.nombreCompleto = std::move(campos[0]);
+        estudiante.numeroIdentificacion = std::move(campos[2]);
+        estudiante.email = std::move(campos[4]);
+        destino.push_back(std::move(estudiante));
+
+        inicio = siguiente;
+    }
+}
+
+} // namespace
+
+// Leer un roster CSV, opcionalmente en paralelo por tramos
+std::vector<Estudiante> leerRosterCSV(const std::string& nombreArchivo, int hilos) {
+    ArchivoMapeado archivo(nombreArchivo);
+    const char* inicio = archivo.obtenerDatos();
+    const char* fin = inicio + archivo.obtenerTamanio();
+
+    // Archivos pequeños no justifican más hilos
+    const size_t minimoPorHilo = 1 << 20;
+    size_t maximoHilos = std::max<size_t>(1, archivo.obtenerTamanio() / minimoPorHilo);
+    size_t cantidadHilos = std::min(static_cast<size_t>(std::max(hilos, 1)), maximoHilos);
+
+    // Cortar en saltos de línea fuera de comillas para que ningún tramo parta un
+    // registro. Para saber si un corte cae dentro de un campo se cuentan las
+    // comillas desde el corte anterior (con memchr, sin interpretar nada).
+    std::vector<const char*> cortes{inicio};
+    for (size_t t = 1; t < cantidadHilos; t++) {
+        const char* corte = inicio + archivo.obtenerTamanio() * t / cantidadHilos;
+        corte = std::max(corte, cortes.back());
+        bool entreComillas = contarComillas(cortes.back(), corte, false);
+        const char* salto = buscarFinRegistro(corte, fin, entreComillas);
+        cortes.push_back(salto < fin ? salto + 1 : fin);
+    }
+    cortes.push_back(fin);
+
+    std::vector<std::vector<Estudiante>> partes(cantidadHilos);
+    std::vector<std::exception_ptr> errores(cantidadHilos);
+    std::vector<std::thread> trabajadores;
+
+    for (size_t t = 1; t < cantidadHilos; t++) {
+        trabajadores.emplace_back([&, t]() {
+            try {
+                interpretarTramoCSV(cortes[t], cortes[t + 1], partes[t]);
+            } catch (...) {
+                errores[t] = std::current_exception();
+            }
+        });
+    }
+    try {
+        interpretarTramoCSV(cortes[0], cortes[1], partes[0]);
+    } catch (...) {
+        errores[0] = std::current_exception();
+    }
+    for (auto& trabajador : trabajadores) {
+        trabajador.join();
+    }
+    for (const auto& error : errores) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Unir los tramos en orden
+    if (cantidadHilos == 1) {
+        return std::move(partes[0]);
+    }
+    size_t total = 0;
+    for (const auto& parte : partes) {
+        total += parte.size();
+    }
+    std::vector<Estudiante> estudiantes;
+    estudiantes.reserve(total);
+    for (auto& parte : partes) {
+        std::move(parte.begin(), parte.end(), std::back_inserter(estudiantes));
+    }
+    return estudiantes;
+}
+
+// ========== FORMATO BINARIO ==========
+
+namespace {
+
+template <typename T>
+T leerValor(const char* origen) {
+    T valor;
+    std::memcpy(&valor, origen, sizeof(T));
+    return valor;
+}
+
+template <typename T>
+void escribirValor(std::string& destino, T valor) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &valor, sizeof(T));
+    destino.append(bytes, sizeof(T));
+}
+
+} // namespace
+
+// Codificar un registro del roster binario al final de 'destino'
+void codificarEstudiante(std::string& destino, const Estudiante& estudiante) {
+    escribirValor<int32_t>(destino, estudiante.anioNacimiento);
+    escribirValor<double>(destino, estudiante.promedioAcademico);
+    escribirValor<uint32_t>(destino, static_cast<uint32_t>(estudiante.nombreCompleto.size()));
+    escribirValor<uint32_t>(destino, static_cast<uint32_t>(estudiante.numeroIdentificacion.size()));
+    escribirValor<uint32_t>(destino, static_cast<uint32_t>(estudiante.email.size()));
+    destino += estudiante.nombreCompleto;
+    destino += estudiante.numeroIdentificacion;
+    destino += estudiante.email;
+}
+
+// Decodificar un registro validando los largos contra los bytes disponibles
+size_t decodificarEstudiante(const char* datos, size_t tamanio, Estudiante& estudiante) {
+    if (tamanio < TAMANIO_REGISTRO_ROSTER) {
+        return 0;
+    }
+    uint32_t largoNombre = leerValor<uint32_t>(datos + 12);
+    uint32_t largoId = leerValor<uint32_t>(datos + 16);
+    uint32_t largoEmail = leerValor<uint32_t>(datos + 20);
+    uint64_t largoTexto = uint64_t(largoNombre) + largoId + largoEmail;
+    if (largoTexto > tamanio - TAMANIO_REGISTRO_ROSTER) {
+        return 0;
+    }
+
+    const char* texto = datos + TAMANIO_REGISTRO_ROSTER;
+    estudiante.nombreCompleto.assign(texto, largoNombre);
+    estudiante.numeroIdentificacion.assign(texto + largoNombre, largoId);
+    estudiante.email.assign(texto + largoNombre + largoId, largoEmail);
+    estudiante.anioNacimiento = leerValor<int32_t>(datos);
+    estudiante.promedioAcademico = leerValor<double>(datos + 4);
+    return TAMANIO_REGISTRO_ROSTER + static_cast<size_t>(largoTexto);
+}
+
+// Interpretar un roster binario en memoria, validando cada largo contra el tamaño
+std::vector<Estudiante> interpretarRosterBinario(const char* datos, size_t tamanio) {
+    if (tamanio < TAMANIO_CABECERA_ROSTER || std::memcmp(datos, MAGICO_ROSTER, 8) != 0) {
+        throw std::runtime_error("El archivo no es un roster binario");
+    }
+    if (leerValor<uint32_t>(datos + 8) != VERSION_ROSTER) {
+        throw std::runtime_error("Versión de roster binario no soportada");
+    }
+
+    uint64_t cantidad = leerValor<uint64_t>(datos + 16);
+    size_t posicion = TAMANIO_CABECERA_ROSTER;
+    if (cantidad > (tamanio - posicion) / TAMANIO_REGISTRO_ROSTER) {
+        throw std::runtime_error("Roster binario truncado");
+    }
+
+    std::vector<Estudiante> estudiantes(static_cast<size_t>(cantidad));
+    for (Estudiante& estudiante : estudiantes) {
+        size_t largo = decodificarEstudiante(datos + posicion, tamanio - posicion, estudiante);
+        if (largo == 0) {
+            throw std::runtime_error("Roster binario truncado");
+        }
+        posicion += largo;
+    }
+
+    return estudiantes;
+}
+
+// Leer un roster binario proyectándolo en memoria
+std::vector<Estudiante> leerRosterBinario(const std::string& nombreArchivo) {
+    ArchivoMapeado archivo(nombreArchivo);
+    return interpretarRosterBinario(archivo.obtenerDatos(), archivo.obtenerTamanio());
+}
+
+// Serializar la lista completa en formato binario
+std::string serializarRosterBinario(const ListadoEstudiantil& lista) {
+    std::string bufer;
+    bufer.append(MAGICO_ROSTER, 8);
+    escribirValor<uint32_t>(bufer, VERSION_ROSTER);
+    escribirValor<uint32_t>(bufer, 0);
+    escribirValor<uint64_t>(bufer, static_cast<uint64_t>(lista.obtenerTamanio()));
+
+    lista.recorrer([&bufer](const Estudiante& estudiante) { codificarEstudiante(bufer, estudiante); });
+    return bufer;
+}
+
+// Escribir la lista en formato binario con un único búfer
+void escribirRosterBinario(const ListadoEstudiantil& lista, const std::string& nombreArchivo) {
+    std::string bufer = serializarRosterBinario(lista);
+
+    std::ofstream archivo(nombreArchivo, std::ios::binary);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo para escritura");
+    }
+    archivo.write(bufer.data(), static_cast<std::streamsize>(bufer.size()));
+    if (!archivo) {
+        throw std::runtime_error("Error al escribir el roster binario");
+    }
+}
+
+// ========== EXPORTACIÓN ==========
+
+namespace {
+
+void agregarEntero(std::string& destino, long valor) {
+    char bytes[24];
+    auto resultado = std::to_chars(bytes, bytes + sizeof(bytes), valor);
+    destino.append(bytes, resultado.ptr);
+}
+
+// Representación más corta que se vuelve a leer exacta (CSV y JSON)
+void agregarReal(std::string& destino, double valor) {
+    char bytes[32];
+    auto resultado = std::to_chars(bytes, bytes + sizeof(bytes), valor);
+    destino.append(bytes, resultado.ptr);
+}
+
+// Igual que ostream << double por defecto (%g con 6 dígitos), para el reporte
+void agregarRealReporte(std::string& destino, double valor) {
+    char bytes[32];
+    auto resultado = std::to_chars(bytes, bytes + sizeof(bytes), valor, std::chars_format::general, 6);
+    destino.append(bytes, resultado.ptr);
+}
+
+// Campo CSV: entre comillas solo si contiene separadores o comillas
+void agregarCampoCSV(std::string& destino, const std::string& campo) {
+    if (campo.find_first_of(",\"\r\n") == std::string::npos) {
+        destino += campo;
+        return;
+    }
+    destino.push_back('"');
+    for (char c : campo) {
+        if (c == '"') {
+            destino.push_back('"');
+        }
+        destino.push_back(c);
+    }
+    destino.push_back('"');
+}
+
+// Cadena JSON; los bytes UTF-8 pasan sin cambios
+void agregarCadenaJSON(std::string& destino, const std::string& texto) {
+    static const char hexadecimal[] = "0123456789abcdef";
+    destino.push_back('"');
+    for (char c : texto) {
+        unsigned char u = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            destino.push_back('\\');
+            destino.push_back(c);
+        } else if (u < 0x20) {
+            destino += "\\u00";
+            destino.push_back(hexadecimal[u >> 4]);
+            destino.push_back(hexadecimal[u & 0xF]);
+        } else {
+            destino.push_back(c);
+        }
+    }
+    destino.push_back('"');
+}
+
+// Formatear un estudiante; 'numero' es su posición en la lista desde 1
+void formatearEstudiante(std::string& destino, const Estudiante& estudiante, size_t numero,
+                         FormatoExportacion formato) {
+    switch (formato) {
+        case FormatoExportacion::Texto:
+            destino += "Estudiante #";
+            agregarEntero(destino, static_cast<long>(numero));
+            destino += "\n----------------------------------------\nNombre Completo: ";
+            destino += estudiante.nombreCompleto;
+            destino += "\nAño de Nacimiento: ";
+            agregarEntero(destino, estudiante.anioNacimiento);
+            destino += "\nNúmero de Identificación: ";
+            destino += estudiante.numeroIdentificacion;
+            destino += "\nPromedio Académico: ";
+            agregarRealReporte(destino, estudiante.promedioAcademico);
+            destino += "\nEmail: ";
+            destino += estudiante.email;
+            destino += "\n\n";
+            break;
+        case FormatoExportacion::CSV:
+            agregarCampoCSV(destino, estudiante.nombreCompleto);
+            destino.push_back(',');
+            agregarEntero(destino, estudiante.anioNacimiento);
+            destino.push_back(',');
+            agregarCampoCSV(destino, estudiante.numeroIdentificacion);
+            destino.push_back(',');
+            agregarReal(destino, estudiante.promedioAcademico);
+            destino.push_back(',');
+            agregarCampoCSV(destino, estudiante.email);
+            destino.push_back('\n');
+            break;
+        case FormatoExportacion::JSONL:
+            destino += "{\"nombreCompleto\":";
+            agregarCadenaJSON(destino, estudiante.nombreCompleto);
+            destino += ",\"anioNacimiento\":";
+            agregarEntero(destino, estudiante.anioNacimiento);
+            destino += ",\"numeroIdentificacion\":";
+            agregarCadenaJSON(destino, estudiante.numeroIdentificacion);
+            destino += ",\"promedioAcademico\":";
+            if (std::isfinite(estudiante.promedioAcademico)) {
+                agregarReal(destino, estudiante.promedioAcademico);
+            } else {
+                destino += "null"; // JSON no admite NaN ni infinito
+            }
+            destino += ",\"email\":";
+            agregarCadenaJSON(destino, estudiante.email);
+            destino += "}\n";
+            break;
+        case FormatoExportacion::Binario:
+            break; // Lo escribe escribirRosterBinario
+    }
+}
+
+void escribirBufer(std::ofstream& archivo, const std::string& bufer) {
+    archivo.write(bufer.data(), static_cast<std::streamsize>(bufer.size()));
+    if (!archivo) {
+        throw std::runtime_error("Error al escribir la exportación");
+    }
+}
+
+} // namespace
+
+void exportarRoster(const ListadoEstudiantil& lista, const std::string& nombreArchivo,
+                    FormatoExportacion formato, int hilos) {
+    if (formato == FormatoExportacion::Binario) {
+        escribirRosterBinario(lista, nombreArchivo);
+        return;
+    }
+
+    // El reporte conserva los saltos de línea de la plataforma, como antes
+    std::ofstream archivo(nombreArchivo, formato == FormatoExportacion::Texto ? std::ios::out : std::ios::binary);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo para escritura");
+    }
+
+    std::string bufer;
+    if (formato == FormatoExportacion::Texto) {
+        bufer += "========================================\n";
+        bufer += "     LISTADO DE ESTUDIANTES\n";
+        bufer += "========================================\n\n";
+    } else if (formato == FormatoExportacion::CSV) {
+        bufer += CABECERA_CSV_ROSTER;
+        bufer += "\n";
+    }
+    escribirBufer(archivo, bufer);
+
+    // Registros en orden, sin copiarlos
+    std::vector<const Estudiante*> registros;
+    registros.reserve(static_cast<size_t>(lista.obtenerTamanio()));
+    lista.recorrer([&registros](const Estudiante& estudiante) { registros.push_back(&estudiante); });
+
+    // Cada ronda formatea hasta 'cantidadHilos' tramos en paralelo y los escribe
+    // en orden, así la memoria queda acotada por tramo y no por lista
+    const size_t porTramo = 16384;
+    size_t cantidadHilos = static_cast<size_t>(std::max(hilos, 1));
+    std::vector<std::string> tramos(cantidadHilos);
+
+    auto formatearTramo = [&](size_t t, size_t inicio) {
+        std::string& destino = tramos[t];
+        destino.clear();
+        size_t fin = std::min(inicio + porTramo, registros.size());
+        for (size_t i = inicio; i < fin; i++) {
+            formatearEstudiante(destino, *registros[i], i + 1, formato);
+        }
+    };
+
+    for (size_t ronda = 0; ronda < registros.size(); ronda += porTramo * cantidadHilos) {
+        std::vector<std::thread> trabajadores;
+        size_t usados = 1;
+        for (size_t t = 1; t < cantidadHilos; t++) {
+            size_t inicio = ronda + t * porTramo;
+            if (inicio >= registros.size()) {
+                break;
+            }
+            trabajadores.emplace_back(formatearTramo, t, inicio);
+            usados++;
+        }
+        formatearTramo(0, ronda);
+        for (std::thread& trabajador : trabajadores) {
+            trabajador.join();
+        }
+        for (size_t t = 0; t < usados; t++) {
+            escribirBufer(archivo, tramos[t]);
+        }
+    }
+
+    if (formato == FormatoExportacion::Texto) {
+        bufer.clear();
+        bufer += "========================================\n";
+        bufer += "Total de estudiantes: ";
+        agregarEntero(bufer, lista.obtenerTamanio());
+        bufer += "\n========================================\n";
+        escribirBufer(archivo, bufer);
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef ARCHIVO_ROSTER_H
+#define ARCHIVO_ROSTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ListadoEstudiantil.h"
+
+// Clase ArchivoMapeado - Archivo de solo lectura proyectado en memoria (mmap)
+// En sistemas sin mmap el contenido se lee completo a un búfer.
+class ArchivoMapeado {
+private:
+    const char* datos;
+    size_t tamanio;
+    std::vector<char> respaldo; // Solo se usa si no hay mmap
+
+public:
+    // Constructor - lanza std::runtime_error si el archivo no se puede abrir
+    explicit ArchivoMapeado(const std::string& nombreArchivo);
+
+    // Destructor - libera la proyección
+    ~ArchivoMapeado();
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+
+    const char* obtenerDatos() const { return datos; }
+    size_t obtenerTamanio() const { return tamanio; }
+};
+
+// Formato CSV del roster (un registro por línea, cabecera opcional):
+//   nombreCompleto,anioNacimiento,numeroIdentificacion,promedioAcademico,email
+// Los campos pueden ir entre comillas dobles ("" escapa una comilla); un campo
+// entre comillas puede contener saltos de línea, como los que escribe exportar.
+extern const char* const CABECERA_CSV_ROSTER;
+
+// Formato binario del roster (little-endian):
+//   Cabecera: "ROSTER01" (8 bytes), uint32 versión, uint32 reservado, uint64 cantidad
+//   Registro: int32 año, float64 promedio, uint32 largo nombre, uint32 largo ID,
+//             uint32 largo email, seguidos de los bytes de nombre, ID y email
+constexpr char MAGICO_ROSTER[8] = {'R', 'O', 'S', 'T', 'E', 'R', '0', '1'};
+constexpr uint32_t VERSION_ROSTER = 1;
+constexpr size_t TAMANIO_CABECERA_ROSTER = 24;
+constexpr size_t TAMANIO_REGISTRO_ROSTER = 24;
+
+// Leer un roster CSV; con hilos > 1 el archivo se divide en tramos que se
+// interpretan en paralelo y se unen en orden. Lanza std::runtime_error ante
+// un archivo inexistente o un registro mal formado.
+std::vector<Estudiante> leerRosterCSV(const std::string& nombreArchivo, int hilos = 1);
+
+// Leer un roster binario. Lanza std::runtime_error si el archivo no es válido.
+std::vector<Estudiante> leerRosterBinario(const std::string& nombreArchivo);
+
+// Interpretar un roster binario que ya está en memoria
+std::vector<Estudiante> interpretarRosterBinario(const char* datos, size_t tamanio);
+
+// Serializar la lista completa en formato binario (cabecera + registros)
+std::string serializarRosterBinario(const ListadoEstudiantil& lista);
+
+// Codificar un registro binario al final de 'destino'
+void codificarEstudiante(std::string& destino, const Estudiante& estudiante);
+
+// Decodificar un registro binario; devuelve los bytes consumidos o 0 si los
+// datos están truncados
+size_t decodificarEstudiante(const char* datos, size_t tamanio, Estudiante& estudiante);
+
+// Escribir la lista en formato binario. Lanza std::runtime_error si falla.
+void escribirRosterBinario(const ListadoEstudiantil& lista, const std::string& nombreArchivo);
+
+// Exportar la lista en el formato pedido. Los números se formatean con
+// std::to_chars en búferes propios; con hilos > 1 cada ronda reparte tramos de
+// registros entre los hilos y los escribe en orden. Lanza std::runtime_error.
+void exportarRoster(const ListadoEstudiantil& lista, const std::string& nombreArchivo,
+                    FormatoExportacion formato, int hilos = 1);
+
+#endif // ARCHIVO_ROSTER_H
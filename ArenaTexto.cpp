@@ -0,0 +1,36 @@
+#include "ArenaTexto.h"
+#include <cstring>
+
+// Constructor - arena vacía, el primer bloque se pide con el primer texto
+ArenaTexto::ArenaTexto()
+    : usadoBloque(0), capacidadBloque(0), bytesUsados(0), bytesReservados(0) {}
+
+// Copiar el texto al bloque actual; si no cabe se abre otro bloque.
+// Un texto más grande que un bloque recibe un bloque propio a su medida.
+std::string_view ArenaTexto::guardar(std::string_view texto) {
+    if (texto.empty()) {
+        return std::string_view();
+    }
+
+    if (texto.size() > capacidadBloque - usadoBloque) {
+        size_t capacidad = texto.size() > TAMANIO_BLOQUE ? texto.size() : TAMANIO_BLOQUE;
+        bloques.emplace_back(new char[capacidad]);
+        usadoBloque = 0;
+        capacidadBloque = capacidad;
+        bytesReservados += capacidad;
+    }
+
+    char* destino = bloques.back().get() + usadoBloque;
+    std::memcpy(destino, texto.data(), texto.size());
+    usadoBloque += texto.size();
+    bytesUsados += texto.size();
+    return std::string_view(destino, texto.size());
+}
+
+void ArenaTexto::limpiar() {
+    bloques.clear();
+    usadoBloque = 0;
+    capacidadBloque = 0;
+    bytesUsados = 0;
+    bytesReservados = 0;
+}
@@ -0,0 +1,43 @@
+#ifndef ARENA_TEXTO_H
+#define ARENA_TEXTO_H
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Clase ArenaTexto - Almacén de texto por bloques grandes
+// Cada texto se copia al final del bloque actual y se devuelve como string_view.
+// Los bloques nunca se mueven, así que las vistas siguen siendo válidas hasta
+// limpiar() o la destrucción de la arena; no se libera texto individual.
+class ArenaTexto {
+private:
+    static constexpr size_t TAMANIO_BLOQUE = 1 << 16;
+
+    std::vector<std::unique_ptr<char[]>> bloques;
+    size_t usadoBloque;     // Bytes ocupados en el bloque actual
+    size_t capacidadBloque; // Capacidad del bloque actual
+    size_t bytesUsados;
+    size_t bytesReservados;
+
+public:
+    ArenaTexto();
+
+    // Se puede mover (las vistas siguen apuntando a los mismos bloques) pero no copiar
+    ArenaTexto(ArenaTexto&&) = default;
+    ArenaTexto& operator=(ArenaTexto&&) = default;
+    ArenaTexto(const ArenaTexto&) = delete;
+    ArenaTexto& operator=(const ArenaTexto&) = delete;
+
+    // Copiar el texto a la arena (O(largo), una asignación cada 64 KB)
+    std::string_view guardar(std::string_view texto);
+
+    // Liberar todos los bloques de una vez
+    void limpiar();
+
+    size_t obtenerBytesUsados() const { return bytesUsados; }
+    size_t obtenerBytesReservados() const { return bytesReservados; }
+    size_t obtenerCantidadBloques() const { return bloques.size(); }
+};
+
+#endif // ARENA_TEXTO_H
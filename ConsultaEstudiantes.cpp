@@ -0,0 +1,255 @@
+#include "ConsultaEstudiantes.h"
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CONSULTA_ESTUDIANTES_X86 1
+#endif
+
+namespace {
+
+// Comparación escalar; los casos se resuelven en compilación
+template <Comparacion C, typename T>
+inline bool comparar(T x, T valor) {
+    if constexpr (C == Comparacion::Menor) return x < valor;
+    else if constexpr (C == Comparacion::MenorIgual) return x <= valor;
+    else if constexpr (C == Comparacion::Mayor) return x > valor;
+    else if constexpr (C == Comparacion::MayorIgual) return x >= valor;
+    else if constexpr (C == Comparacion::Igual) return x == valor;
+    else return x != valor;
+}
+
+// Versión escalar: 64 comparaciones por palabra del mapa de bits
+template <Comparacion C, typename T>
+void compararEscalar(const T* columna, size_t filas, T valor, uint64_t* mascara) {
+    for (size_t base = 0; base < filas; base += 64) {
+        size_t cantidad = std::min<size_t>(64, filas - base);
+        uint64_t bits = 0;
+        for (size_t j = 0; j < cantidad; j++) {
+            bits |= uint64_t(comparar<C>(columna[base + j], valor)) << j;
+        }
+        mascara[base / 64] = bits;
+    }
+}
+
+#ifdef CONSULTA_ESTUDIANTES_X86
+// Predicado de _mm256_cmp_pd equivalente a la comparación escalar
+// (ordenado salvo Distinto, que como != es verdadero con NaN)
+template <Comparacion C>
+constexpr int predicadoAVX() {
+    if constexpr (C == Comparacion::Menor) return _CMP_LT_OQ;
+    else if constexpr (C == Comparacion::MenorIgual) return _CMP_LE_OQ;
+    else if constexpr (C == Comparacion::Mayor) return _CMP_GT_OQ;
+    else if constexpr (C == Comparacion::MayorIgual) return _CMP_GE_OQ;
+    else if constexpr (C == Comparacion::Igual) return _CMP_EQ_OQ;
+    else return _CMP_NEQ_UQ;
+}
+
+// Versión AVX2 para reales: 4 comparaciones por instrucción, el resultado se
+// empaqueta con movemask; la última palabra incompleta va por la versión escalar
+template <Comparacion C>
+__attribute__((target("avx2")))
+void compararRealesAVX2(const double* columna, size_t filas, double valor, uint64_t* mascara) {
+    __m256d v = _mm256_set1_pd(valor);
+    size_t completas = filas / 64;
+    for (size_t w = 0; w < completas; w++) {
+        const double* p = columna + w * 64;
+        uint64_t bits = 0;
+        for (size_t j = 0; j < 64; j += 4) {
+            __m256d x = _mm256_loadu_pd(p + j);
+            bits |= uint64_t(_mm256_movemask_pd(_mm256_cmp_pd(x, v, predicadoAVX<C>()))) << j;
+        }
+        mascara[w] = bits;
+    }
+    compararEscalar<C>(columna + completas * 64, filas % 64, valor, mascara + completas);
+}
+
+// Versión AVX2 para enteros: 8 comparaciones por instrucción. AVX2 solo tiene
+// > e ==; el resto se obtiene cambiando el orden de los operandos o negando.
+template <Comparacion C>
+__attribute__((target("avx2")))
+void compararEnterosAVX2(const int* columna, size_t filas, int valor, uint64_t* mascara) {
+    __m256i v = _mm256_set1_epi32(valor);
+    constexpr bool negar = C == Comparacion::MenorIgual || C == Comparacion::MayorIgual ||
+                           C == Comparacion::Distinto;
+    size_t completas = filas / 64;
+    for (size_t w = 0; w < completas; w++) {
+        const int* p = columna + w * 64;
+        uint64_t bits = 0;
+        for (size_t j = 0; j < 64; j += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + j));
+            __m256i r;
+            if constexpr (C == Comparacion::Mayor || C == Comparacion::MenorIgual) {
+                r = _mm256_cmpgt_epi32(x, v);
+            } else if constexpr (C == Comparacion::Menor || C == Comparacion::MayorIgual) {
+                r = _mm256_cmpgt_epi32(v, x);
+            } else {
+                r = _mm256_cmpeq_epi32(x, v);
+            }
+            uint64_t m = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(r)));
+            if (negar) {
+                m ^= 0xFF;
+            }
+            bits |= m << j;
+        }
+        mascara[w] = bits;
+    }
+    compararEscalar<C>(columna + completas * 64, filas % 64, valor, mascara + completas);
+}
+
+bool detectarAVX2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+// Selección del núcleo una sola vez según la CPU
+const bool hayAVX2 = detectarAVX2();
+#endif
+
+template <Comparacion C, typename T>
+void compararNucleo(const T* columna, size_t filas, T valor, uint64_t* mascara) {
+#ifdef CONSULTA_ESTUDIANTES_X86
+    if (hayAVX2) {
+        if constexpr (std::is_same<T, double>::value) {
+            compararRealesAVX2<C>(columna, filas, valor, mascara);
+        } else {
+            compararEnterosAVX2<C>(columna, filas, valor, mascara);
+        }
+        return;
+    }
+#endif
+    compararEscalar<C>(columna, filas, valor, mascara);
+}
+
+// Instanciar el núcleo que corresponde a la comparación pedida
+template <typename T>
+void compararColumna(const T* columna, size_t filas, T valor, Comparacion comparacion,
+                     uint64_t* mascara) {
+    switch (comparacion) {
+        case Comparacion::Menor:
+            compararNucleo<Comparacion::Menor>(columna, filas, valor, mascara);
+            break;
+        case Comparacion::MenorIgual:
+            compararNucleo<Comparacion::MenorIgual>(columna, filas, valor, mascara);
+            break;
+        case Comparacion::Mayor:
+            compararNucleo<Comparacion::Mayor>(columna, filas, valor, mascara);
+            break;
+        case Comparacion::MayorIgual:
+            compararNucleo<Comparacion::MayorIgual>(columna, filas, valor, mascara);
+            break;
+        case Comparacion::Igual:
+            compararNucleo<Comparacion::Igual>(columna, filas, valor, mascara);
+            break;
+        case Comparacion::Distinto:
+            compararNucleo<Comparacion::Distinto>(columna, filas, valor, mascara);
+            break;
+    }
+}
+
+} // namespace
+
+// Constructor - consulta sin condiciones (selecciona todo)
+ConsultaEstudiantes::ConsultaEstudiantes(const ListadoEstudiantil& lista)
+    : lista(lista), grupos(1) {}
+
+ConsultaEstudiantes& ConsultaEstudiantes::dondeAnio(Comparacion comparacion, int anio) {
+    grupos.back().push_back(Condicion{Columna::Anio, comparacion, anio, 0.0});
+    return *this;
+}
+
+ConsultaEstudiantes& ConsultaEstudiantes::dondePromedio(Comparacion comparacion, double promedio) {
+    grupos.back().push_back(Condicion{Columna::Promedio, comparacion, 0, promedio});
+    return *this;
+}
+
+// Un grupo vacío no se abre dos veces
+ConsultaEstudiantes& ConsultaEstudiantes::o() {
+    if (!grupos.back().empty()) {
+        grupos.emplace_back();
+    }
+    return *this;
+}
+
+void ConsultaEstudiantes::evaluarCondicion(const Condicion& condicion, uint64_t* mascara) const {
+    size_t filas = lista.orden.size();
+    if (condicion.columna == Columna::Anio) {
+        compararColumna(lista.columnaAnio.data(), filas, condicion.valorEntero,
+                        condicion.comparacion, mascara);
+    } else {
+        compararColumna(lista.columnaPromedio.data(), filas, condicion.valorReal,
+                        condicion.comparacion, mascara);
+    }
+}
+
+// OR de los grupos; cada grupo parte de las filas ocupadas y se reduce con AND
+std::vector<uint64_t> ConsultaEstudiantes::evaluar() const {
+    const std::vector<uint64_t>& ocupadas = lista.filasOcupadas;
+    size_t palabras = ocupadas.size();
+
+    bool sinCondiciones = std::all_of(grupos.begin(), grupos.end(),
+                                      [](const std::vector<Condicion>& g) { return g.empty(); });
+    if (sinCondiciones) {
+        return ocupadas;
+    }
+
+    std::vector<uint64_t> resultado(palabras, 0);
+    std::vector<uint64_t> grupo(palabras);
+    std::vector<uint64_t> condicion(palabras);
+
+    for (const std::vector<Condicion>& condiciones : grupos) {
+        if (condiciones.empty()) {
+            continue;
+        }
+        grupo = ocupadas;
+        for (const Condicion& c : condiciones) {
+            evaluarCondicion(c, condicion.data());
+            for (size_t w = 0; w < palabras; w++) {
+                grupo[w] &= condicion[w];
+            }
+        }
+        for (size_t w = 0; w < palabras; w++) {
+            resultado[w] |= grupo[w];
+        }
+    }
+    return resultado;
+}
+
+size_t ConsultaEstudiantes::contar() const {
+    size_t total = 0;
+    for (uint64_t palabra : evaluar()) {
+        total += static_cast<size_t>(__builtin_popcountll(palabra));
+    }
+    return total;
+}
+
+// Recorrer los bits encendidos de menor a mayor fila
+std::vector<Manejador> ConsultaEstudiantes::manejadores() const {
+    std::vector<uint64_t> mascara = evaluar();
+    std::vector<Manejador> resultado;
+    for (size_t w = 0; w < mascara.size(); w++) {
+        for (uint64_t bits = mascara[w]; bits != 0; bits &= bits - 1) {
+            resultado.push_back(lista.orden[w * 64 + __builtin_ctzll(bits)]);
+        }
+    }
+    return resultado;
+}
+
+std::vector<Estudiante> ConsultaEstudiantes::ejecutar() const {
+    std::vector<Manejador> seleccion = manejadores();
+    std::vector<Estudiante> resultado;
+    resultado.reserve(seleccion.size());
+    for (const Manejador& manejador : seleccion) {
+        resultado.push_back(lista.almacen[manejador]);
+    }
+    return resultado;
+}
+
+bool ConsultaEstudiantes::usaAVX2() {
+#ifdef CONSULTA_ESTUDIANTES_X86
+    return hayAVX2;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,71 @@
+#ifndef CONSULTA_ESTUDIANTES_H
+#define CONSULTA_ESTUDIANTES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ListadoEstudiantil.h"
+
+// Operadores de comparación de un predicado
+enum class Comparacion { Menor, MenorIgual, Mayor, MayorIgual, Igual, Distinto };
+
+// Clase ConsultaEstudiantes - Filtrado por columnas sin índices
+// Cada condición compara una columna numérica completa de la lista contra una
+// constante y produce un mapa de bits (un bit por fila, núcleo AVX2 si existe).
+// Las condiciones se combinan con AND dentro de un grupo y los grupos con OR
+// (forma normal disyuntiva); los registros se materializan solo al final.
+//
+//   ConsultaEstudiantes consulta(lista);
+//   consulta.dondeAnio(Comparacion::MayorIgual, 2002)
+//           .dondePromedio(Comparacion::Mayor, 3.5)
+//           .o()
+//           .dondeAnio(Comparacion::Igual, 1999);
+//   std::vector<Estudiante> resultado = consulta.ejecutar();
+//
+// La consulta guarda una referencia a la lista: no debe modificarse la lista
+// mientras se evalúa.
+class ConsultaEstudiantes {
+private:
+    enum class Columna { Anio, Promedio };
+
+    struct Condicion {
+        Columna columna;
+        Comparacion comparacion;
+        int valorEntero;
+        double valorReal;
+    };
+
+    const ListadoEstudiantil& lista;
+    std::vector<std::vector<Condicion>> grupos; // OR de grupos, AND dentro de cada uno
+
+    // Evaluar todas las condiciones en un mapa de bits de filas de 'orden'
+    std::vector<uint64_t> evaluar() const;
+
+    // Escribir en 'mascara' el resultado de una condición sobre todas las filas
+    void evaluarCondicion(const Condicion& condicion, uint64_t* mascara) const;
+
+public:
+    explicit ConsultaEstudiantes(const ListadoEstudiantil& lista);
+
+    // Agregar una condición al grupo actual (AND)
+    ConsultaEstudiantes& dondeAnio(Comparacion comparacion, int anio);
+    ConsultaEstudiantes& dondePromedio(Comparacion comparacion, double promedio);
+
+    // Cerrar el grupo actual y empezar otro (OR)
+    ConsultaEstudiantes& o();
+
+    // Cantidad de estudiantes que cumplen la consulta (sin materializar)
+    size_t contar() const;
+
+    // Manejadores de los estudiantes que cumplen, en el orden de la lista
+    std::vector<Manejador> manejadores() const;
+
+    // Copias de los estudiantes que cumplen, en el orden de la lista.
+    // Sin condiciones se devuelven todos.
+    std::vector<Estudiante> ejecutar() const;
+
+    // Verdadero si las comparaciones usan el núcleo AVX2
+    static bool usaAVX2();
+};
+
+#endif // CONSULTA_ESTUDIANTES_H
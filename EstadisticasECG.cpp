@@ -0,0 +1,368 @@
+#include "EstadisticasECG.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define ESTADISTICAS_ECG_X86 1
+#endif
+
+// ========== SKETCH KLL ==========
+
+// Constructor - sketch vacío con un solo nivel
+SketchKLL::SketchKLL(int precision)
+    : k(std::max(precision, 8)), cantidad(0), estadoAleatorio(0x9E3779B97F4A7C15ULL),
+      niveles(1), capacidadTotal(0) {
+    actualizarCapacidades();
+}
+
+// La capacidad decrece geométricamente (factor 2/3) hacia los niveles bajos
+void SketchKLL::actualizarCapacidades() {
+    capacidades.resize(niveles.size());
+    capacidadTotal = 0;
+    for (size_t h = 0; h < niveles.size(); h++) {
+        size_t profundidad = niveles.size() - 1 - h;
+        double capacidad = std::ceil(k * std::pow(2.0 / 3.0, static_cast<double>(profundidad)));
+        capacidades[h] = std::max<size_t>(2, static_cast<size_t>(capacidad));
+        capacidadTotal += capacidades[h];
+    }
+}
+
+size_t SketchKLL::elementosRetenidos() const {
+    size_t total = 0;
+    for (const auto& nivel : niveles) {
+        total += nivel.size();
+    }
+    return total;
+}
+
+// Generador xorshift64: barato y determinista para elegir el desfase
+bool SketchKLL::bitAleatorio() {
+    estadoAleatorio ^= estadoAleatorio << 13;
+    estadoAleatorio ^= estadoAleatorio >> 7;
+    estadoAleatorio ^= estadoAleatorio << 17;
+    return (estadoAleatorio & 1) != 0;
+}
+
+// Compactar el primer nivel lleno: ordenar y promover uno de cada dos elementos
+void SketchKLL::compactar() {
+    while (elementosRetenidos() > capacidadTotal) {
+        for (size_t h = 0; h < niveles.size(); h++) {
+            if (niveles[h].size() < capacidades[h]) {
+                continue;
+            }
+
+            if (h + 1 == niveles.size()) {
+                niveles.emplace_back();
+                actualizarCapacidades();
+            }
+
+            std::vector<double>& nivel = niveles[h];
+            std::sort(nivel.begin(), nivel.end());
+
+            // Si la cantidad es impar, el último elemento se queda en este nivel
+            double sobrante = 0.0;
+            bool haySobrante = (nivel.size() % 2) != 0;
+            if (haySobrante) {
+                sobrante = nivel.back();
+                nivel.pop_back();
+            }
+
+            size_t desfase = bitAleatorio() ? 1 : 0;
+            std::vector<double>& superior = niveles[h + 1];
+            for (size_t i = desfase; i < nivel.size(); i += 2) {
+                superior.push_back(nivel[i]);
+            }
+
+            nivel.clear();
+            if (haySobrante) {
+                nivel.push_back(sobrante);
+            }
+            break;
+        }
+    }
+}
+
+// Agregar un valor al nivel 0
+void SketchKLL::agregar(double valor) {
+    niveles[0].push_back(valor);
+    cantidad++;
+    if (niveles[0].size() >= capacidades[0]) {
+        compactar();
+    }
+}
+
+// Agregar un bloque llenando el nivel 0 por tramos
+void SketchKLL::agregarBloque(const double* datos, size_t n) {
+    size_t i = 0;
+    while (i < n) {
+        size_t libre = capacidades[0] > niveles[0].size() ? capacidades[0] - niveles[0].size() : 0;
+        size_t tramo = std::min(std::max<size_t>(libre, 1), n - i);
+        niveles[0].insert(niveles[0].end(), datos + i, datos + i + tramo);
+        cantidad += tramo;
+        i += tramo;
+        if (niveles[0].size() >= capacidades[0]) {
+            compactar();
+        }
+    }
+}
+
+// Combinar nivel por nivel y recompactar
+void SketchKLL::combinar(const SketchKLL& otro) {
+    if (&otro == this) {
+        SketchKLL copia(otro); // Insertar un vector en sí mismo no es válido
+        combinar(copia);
+        return;
+    }
+    if (otro.niveles.size() > niveles.size()) {
+        niveles.resize(otro.niveles.size());
+        actualizarCapacidades();
+    }
+    for (size_t h = 0; h < otro.niveles.size(); h++) {
+        niveles[h].insert(niveles[h].end(), otro.niveles[h].begin(), otro.niveles[h].end());
+    }
+    cantidad += otro.cantidad;
+    compactar();
+}
+
+// Cuantil aproximado: ordenar las muestras retenidas con su peso 2^h
+double SketchKLL::cuantil(double q) const {
+    if (cantidad == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    std::vector<std::pair<double, uint64_t>> ponderados;
+    ponderados.reserve(elementosRetenidos());
+    uint64_t pesoTotal = 0;
+    for (size_t h = 0; h < niveles.size(); h++) {
+        uint64_t peso = uint64_t(1) << h;
+        for (double valor : niveles[h]) {
+            ponderados.emplace_back(valor, peso);
+            pesoTotal += peso;
+        }
+    }
+    std::sort(ponderados.begin(), ponderados.end());
+
+    q = std::min(1.0, std::max(0.0, q));
+    double objetivo = q * static_cast<double>(pesoTotal);
+    uint64_t acumulado = 0;
+    for (const auto& par : ponderados) {
+        acumulado += par.second;
+        if (static_cast<double>(acumulado) >= objetivo) {
+            return par.first;
+        }
+    }
+    return ponderados.back().first;
+}
+
+// ========== NÚCLEOS DE BLOQUE ==========
+
+namespace {
+
+// Mínimo, máximo y suma de un bloque
+struct Resumen {
+    double minimo;
+    double maximo;
+    double suma;
+};
+
+// Versiones escalares con cuatro acumuladores independientes: sin una única
+// cadena de dependencias, el procesador superpone las sumas
+Resumen resumenEscalar(const double* datos, size_t n) {
+    double minimos[4] = {datos[0], datos[0], datos[0], datos[0]};
+    double maximos[4] = {datos[0], datos[0], datos[0], datos[0]};
+    double sumas[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t j = 0; j < 4; j++) {
+            minimos[j] = datos[i + j] < minimos[j] ? datos[i + j] : minimos[j];
+            maximos[j] = datos[i + j] > maximos[j] ? datos[i + j] : maximos[j];
+            sumas[j] += datos[i + j];
+        }
+    }
+    for (; i < n; i++) {
+        minimos[0] = datos[i] < minimos[0] ? datos[i] : minimos[0];
+        maximos[0] = datos[i] > maximos[0] ? datos[i] : maximos[0];
+        sumas[0] += datos[i];
+    }
+    return {std::min(std::min(minimos[0], minimos[1]), std::min(minimos[2], minimos[3])),
+            std::max(std::max(maximos[0], maximos[1]), std::max(maximos[2], maximos[3])),
+            (sumas[0] + sumas[1]) + (sumas[2] + sumas[3])};
+}
+
+double m2Escalar(const double* datos, size_t n, double media) {
+    double m2[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t j = 0; j < 4; j++) {
+            double d = datos[i + j] - media;
+            m2[j] += d * d;
+        }
+    }
+    for (; i < n; i++) {
+        double d = datos[i] - media;
+        m2[0] += d * d;
+    }
+    return (m2[0] + m2[1]) + (m2[2] + m2[3]);
+}
+
+#ifdef ESTADISTICAS_ECG_X86
+__attribute__((target("avx2,fma")))
+double sumaHorizontal(__m256d v) {
+    __m128d bajo = _mm256_castpd256_pd128(v);
+    __m128d alto = _mm256_extractf128_pd(v, 1);
+    bajo = _mm_add_pd(bajo, alto);
+    __m128d par = _mm_unpackhi_pd(bajo, bajo);
+    return _mm_cvtsd_f64(_mm_add_sd(bajo, par));
+}
+
+// Versiones AVX2: 4 muestras por instrucción, el resto con el bucle escalar
+__attribute__((target("avx2,fma")))
+Resumen resumenAVX2(const double* datos, size_t n) {
+    __m256d vmin = _mm256_set1_pd(datos[0]);
+    __m256d vmax = vmin;
+    __m256d vsuma = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_loadu_pd(datos + i);
+        vmin = _mm256_min_pd(vmin, v);
+        vmax = _mm256_max_pd(vmax, v);
+        vsuma = _mm256_add_pd(vsuma, v);
+    }
+    alignas(32) double minimos[4];
+    alignas(32) double maximos[4];
+    _mm256_store_pd(minimos, vmin);
+    _mm256_store_pd(maximos, vmax);
+    Resumen resumen{std::min(std::min(minimos[0], minimos[1]), std::min(minimos[2], minimos[3])),
+                    std::max(std::max(maximos[0], maximos[1]), std::max(maximos[2], maximos[3])),
+                    sumaHorizontal(vsuma)};
+    for (; i < n; i++) {
+        resumen.minimo = datos[i] < resumen.minimo ? datos[i] : resumen.minimo;
+        resumen.maximo = datos[i] > resumen.maximo ? datos[i] : resumen.maximo;
+        resumen.suma += datos[i];
+    }
+    return resumen;
+}
+
+__attribute__((target("avx2,fma")))
+double m2AVX2(const double* datos, size_t n, double media) {
+    __m256d vmedia = _mm256_set1_pd(media);
+    __m256d vm2 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d d = _mm256_sub_pd(_mm256_loadu_pd(datos + i), vmedia);
+        vm2 = _mm256_fmadd_pd(d, d, vm2);
+    }
+    double m2 = sumaHorizontal(vm2);
+    for (; i < n; i++) {
+        double d = datos[i] - media;
+        m2 += d * d;
+    }
+    return m2;
+}
+#endif
+
+// Selección de los núcleos una sola vez según la CPU
+struct Nucleos {
+    Resumen (*resumen)(const double*, size_t);
+    double (*m2)(const double*, size_t, double);
+};
+
+Nucleos seleccionarNucleos() {
+#ifdef ESTADISTICAS_ECG_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return {resumenAVX2, m2AVX2};
+    }
+#endif
+    return {resumenEscalar, m2Escalar};
+}
+
+const Nucleos nucleos = seleccionarNucleos();
+
+} // namespace
+
+// ========== ESTADÍSTICAS EN UNA PASADA ==========
+
+// Constructor - acumulador vacío
+EstadisticasECG::EstadisticasECG(int kSketch)
+    : cantidad(0),
+      minimo(std::numeric_limits<double>::infinity()),
+      maximo(-std::numeric_limits<double>::infinity()),
+      media(0.0), m2(0.0), sketch(kSketch) {}
+
+// Actualización de Welford para una muestra
+void EstadisticasECG::agregar(double valor) {
+    cantidad++;
+    double delta = valor - media;
+    media += delta / static_cast<double>(cantidad);
+    m2 += delta * (valor - media);
+    minimo = std::min(minimo, valor);
+    maximo = std::max(maximo, valor);
+    sketch.agregar(valor);
+}
+
+// Procesar un bloque: mínimo, máximo y suma en una pasada y la suma de
+// cuadrados en otra (núcleo AVX2 si existe), luego unir con la fórmula de Chan
+void EstadisticasECG::agregarBloque(const double* datos, size_t n) {
+    if (n == 0) {
+        return;
+    }
+
+    Resumen resumen = nucleos.resumen(datos, n);
+    double minBloque = resumen.minimo;
+    double maxBloque = resumen.maximo;
+    double mediaBloque = resumen.suma / static_cast<double>(n);
+    double m2Bloque = nucleos.m2(datos, n, mediaBloque);
+
+    sketch.agregarBloque(datos, n);
+
+    // Combinación de momentos (Chan et al.)
+    uint64_t total = cantidad + n;
+    double delta = mediaBloque - media;
+    double fraccion = static_cast<double>(n) / static_cast<double>(total);
+    media += delta * fraccion;
+    m2 += m2Bloque + delta * delta * static_cast<double>(cantidad) * fraccion;
+    cantidad = total;
+    minimo = std::min(minimo, minBloque);
+    maximo = std::max(maximo, maxBloque);
+}
+
+// Combinar con otro acumulador (bloques, archivos o hilos distintos)
+void EstadisticasECG::combinar(const EstadisticasECG& otras) {
+    if (otras.cantidad == 0) {
+        return;
+    }
+
+    uint64_t total = cantidad + otras.cantidad;
+    double delta = otras.media - media;
+    double fraccion = static_cast<double>(otras.cantidad) / static_cast<double>(total);
+    media += delta * fraccion;
+    m2 += otras.m2 + delta * delta * static_cast<double>(cantidad) * fraccion;
+    cantidad = total;
+    minimo = std::min(minimo, otras.minimo);
+    maximo = std::max(maximo, otras.maximo);
+    sketch.combinar(otras.sketch);
+}
+
+// Varianza muestral (n - 1)
+double EstadisticasECG::obtenerVarianza() const {
+    if (cantidad < 2) {
+        return 0.0;
+    }
+    return m2 / static_cast<double>(cantidad - 1);
+}
+
+double EstadisticasECG::obtenerDesviacionEstandar() const {
+    return std::sqrt(obtenerVarianza());
+}
+
+bool EstadisticasECG::usaAVX2() {
+#ifdef ESTADISTICAS_ECG_X86
+    return nucleos.resumen == resumenAVX2;
+#else
+    return false;
+#endif
+}
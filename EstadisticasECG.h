@@ -0,0 +1,90 @@
+#ifndef ESTADISTICAS_ECG_H
+#define ESTADISTICAS_ECG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Sketch KLL para cuantiles aproximados
+// Cada nivel h guarda muestras con peso 2^h; al llenarse, un nivel se ordena
+// y la mitad de sus elementos sube al nivel siguiente. Dos sketches se pueden
+// combinar nivel por nivel, por lo que sirve para bloques e hilos separados.
+class SketchKLL {
+private:
+    int k;
+    uint64_t cantidad;
+    uint64_t estadoAleatorio;
+    std::vector<std::vector<double>> niveles;
+    std::vector<size_t> capacidades; // Se recalculan cuando cambia la altura
+    size_t capacidadTotal;
+
+    // Capacidad de cada nivel según la altura actual del sketch
+    void actualizarCapacidades();
+    size_t elementosRetenidos() const;
+
+    // Compactar niveles hasta volver a la capacidad total
+    void compactar();
+    bool bitAleatorio();
+
+public:
+    // Constructor (a mayor k, menor error en los cuantiles y más memoria)
+    explicit SketchKLL(int precision = 200);
+
+    // Agregar un valor al sketch
+    void agregar(double valor);
+
+    // Agregar un bloque contiguo de valores
+    void agregarBloque(const double* datos, size_t n);
+
+    // Combinar con otro sketch (resultado equivalente a haber visto ambos flujos)
+    void combinar(const SketchKLL& otro);
+
+    // Cuantil aproximado q en [0, 1]
+    double cuantil(double q) const;
+
+    uint64_t obtenerCantidad() const { return cantidad; }
+};
+
+// Clase EstadisticasECG - Acumulador de estadísticas en una sola pasada
+// Mínimo, máximo, media y varianza (Welford/Chan) más cuantiles aproximados.
+// Los resultados de bloques o hilos distintos se unen con combinar().
+class EstadisticasECG {
+private:
+    uint64_t cantidad;
+    double minimo;
+    double maximo;
+    double media;
+    double m2; // Suma de cuadrados de las desviaciones respecto a la media
+    SketchKLL sketch;
+
+public:
+    // Tamaño de bloque recomendado para agregarBloque()
+    static constexpr size_t TAMANIO_BLOQUE = 256;
+
+    // Constructor
+    explicit EstadisticasECG(int kSketch = 200);
+
+    // Agregar una muestra
+    void agregar(double valor);
+
+    // Agregar un bloque contiguo de muestras (núcleo AVX2 si existe)
+    void agregarBloque(const double* datos, size_t n);
+
+    // Combinar con las estadísticas de otro bloque, archivo o hilo
+    void combinar(const EstadisticasECG& otras);
+
+    // Consultas
+    uint64_t obtenerCantidad() const { return cantidad; }
+    double obtenerMinimo() const { return minimo; }
+    double obtenerMaximo() const { return maximo; }
+    double obtenerMedia() const { return media; }
+    double obtenerVarianza() const;
+    double obtenerDesviacionEstandar() const;
+    double obtenerCuantil(double q) const { return sketch.cuantil(q); }
+    double obtenerMediana() const { return sketch.cuantil(0.5); }
+
+    // Indica si agregarBloque usa instrucciones AVX2
+    static bool usaAVX2();
+};
+
+#endif // ESTADISTICAS_ECG_H
@@ -0,0 +1,222 @@
+#ifndef ESTRUCTURAS_LISTA_H
+#define ESTRUCTURAS_LISTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Estructuras auxiliares compartidas por ListadoEstudiantil y
+// ListadoEstudiantilCompacto: las dos guardan los registros en un vector con
+// huecos tras eliminar y los localizan por ID con una tabla hash.
+
+// Clase ArbolFenwick - Árbol de Fenwick de posiciones ocupadas
+// Cada posición vale 1 si está ocupada y 0 si es un hueco; traduce entre
+// posición física e índice lógico en O(log n) mientras haya huecos.
+class ArbolFenwick {
+private:
+    std::vector<int> nodos;
+
+public:
+    // Sumar delta en la posición dada (O(log n))
+    void agregar(int posicion, int delta) {
+        for (int i = posicion + 1; i <= static_cast<int>(nodos.size()); i += i & -i) {
+            nodos[i - 1] += delta;
+        }
+    }
+
+    // Cantidad de posiciones ocupadas antes de 'posicion' (O(log n))
+    int prefijo(int posicion) const {
+        int suma = 0;
+        for (int i = posicion; i > 0; i -= i & -i) {
+            suma += nodos[i - 1];
+        }
+        return suma;
+    }
+
+    // Posición de la k-ésima entrada ocupada (k desde 0), descendiendo por el árbol
+    int seleccionar(int k) const {
+        int posicion = 0;
+        int paso = 1;
+        while (paso * 2 <= static_cast<int>(nodos.size())) {
+            paso *= 2;
+        }
+        for (; paso > 0; paso /= 2) {
+            if (posicion + paso <= static_cast<int>(nodos.size()) && nodos[posicion + paso - 1] <= k) {
+                posicion += paso;
+                k -= nodos[posicion - 1];
+            }
+        }
+        return posicion;
+    }
+
+    // Agregar una posición ocupada al final. Sin huecos todas las hojas valen 1
+    // y el nodo i cubre exactamente (i & -i) posiciones.
+    void extender(bool sinHuecos) {
+        int i = static_cast<int>(nodos.size()) + 1;
+        if (sinHuecos) {
+            nodos.push_back(i & -i);
+        } else {
+            nodos.push_back(1 + prefijo(i - 1) - prefijo(i - (i & -i)));
+        }
+    }
+
+    // Quitar la última posición (debe ser un hueco)
+    void recortar() { nodos.pop_back(); }
+
+    // Reconstruir con n posiciones ocupadas en O(n)
+    void llenar(int n) {
+        nodos.assign(n, 1);
+        for (int i = 1; i <= n; i++) {
+            int padre = i + (i & -i);
+            if (padre <= n) {
+                nodos[padre - 1] += nodos[i - 1];
+            }
+        }
+    }
+
+    void reservar(size_t n) { nodos.reserve(n); }
+    void limpiar() { nodos.clear(); }
+    size_t obtenerBytesReservados() const { return nodos.capacity() * sizeof(int); }
+};
+
+// Plantilla TablaHashAbierta - Tabla hash de direccionamiento abierto
+// Cada entrada guarda el hash de la clave y un valor (manejador o posición);
+// la clave se compara contra el registro al que apunta el valor, así no se
+// duplica. Admite claves repetidas. Capacidad potencia de 2, sondeo lineal y
+// carga máxima del 70 %. El valor 'vacio' marca las entradas libres.
+template <typename Valor>
+class TablaHashAbierta {
+public:
+    struct Entrada {
+        uint32_t hash;
+        Valor valor;
+    };
+
+private:
+    std::vector<Entrada> entradas;
+    size_t ocupadas;
+    Valor vacio;
+
+public:
+    explicit TablaHashAbierta(Valor vacio) : ocupadas(0), vacio(vacio) {}
+
+    TablaHashAbierta(const TablaHashAbierta&) = default;
+    TablaHashAbierta& operator=(const TablaHashAbierta&) = default;
+
+    // Mover deja la tabla de origen vacía y sin asignar memoria
+    TablaHashAbierta(TablaHashAbierta&& otra) noexcept
+        : entradas(std::move(otra.entradas)), ocupadas(std::exchange(otra.ocupadas, 0)), vacio(otra.vacio) {
+        otra.entradas.clear();
+    }
+
+    TablaHashAbierta& operator=(TablaHashAbierta&& otra) noexcept {
+        if (this != &otra) {
+            entradas = std::move(otra.entradas);
+            ocupadas = std::exchange(otra.ocupadas, 0);
+            otra.entradas.clear();
+        }
+        return *this;
+    }
+
+    // Reconstruir la tabla con otra capacidad (potencia de 2)
+    void redimensionar(size_t capacidad) {
+        std::vector<Entrada> anterior;
+        anterior.swap(entradas);
+        entradas.assign(capacidad, Entrada{0, vacio});
+        ocupadas = 0;
+        for (const Entrada& entrada : anterior) {
+            if (!(entrada.valor == vacio)) {
+                insertar(entrada.hash, entrada.valor);
+            }
+        }
+    }
+
+    // Capacidad suficiente para n entradas sin crecer
+    void reservar(size_t n) {
+        size_t capacidad = 16;
+        while (capacidad * 7 < n * 10) {
+            capacidad *= 2;
+        }
+        if (capacidad > entradas.size()) {
+            redimensionar(capacidad);
+        }
+    }
+
+    // Sondeo lineal desde la posición que indica el hash
+    void insertar(uint32_t hash, Valor valor) {
+        if ((ocupadas + 1) * 10 > entradas.size() * 7) {
+            redimensionar(entradas.empty() ? 16 : entradas.size() * 2);
+        }
+        size_t mascara = entradas.size() - 1;
+        size_t i = hash & mascara;
+        while (!(entradas[i].valor == vacio)) {
+            i = (i + 1) & mascara;
+        }
+        entradas[i] = Entrada{hash, valor};
+        ocupadas++;
+    }
+
+    // Borrado con desplazamiento hacia atrás: las entradas siguientes del mismo
+    // grupo se corren para que ninguna búsqueda se corte en el hueco
+    void quitar(size_t entrada) {
+        size_t mascara = entradas.size() - 1;
+        size_t hueco = entrada;
+        size_t j = entrada;
+        while (true) {
+            j = (j + 1) & mascara;
+            if (entradas[j].valor == vacio) {
+                break;
+            }
+            size_t deseada = entradas[j].hash & mascara;
+            if (((j - deseada) & mascara) >= ((j - hueco) & mascara)) {
+                entradas[hueco] = entradas[j];
+                hueco = j;
+            }
+        }
+        entradas[hueco].valor = vacio;
+        ocupadas--;
+    }
+
+    // Llamar a funcion(entrada, valor) por cada entrada con este hash
+    template <typename Funcion>
+    void recorrerGrupo(uint32_t hash, Funcion funcion) const {
+        if (entradas.empty()) {
+            return;
+        }
+        size_t mascara = entradas.size() - 1;
+        for (size_t i = hash & mascara; !(entradas[i].valor == vacio); i = (i + 1) & mascara) {
+            if (entradas[i].hash == hash) {
+                funcion(i, entradas[i].valor);
+            }
+        }
+    }
+
+    // Entrada que contiene el valor (debe estar en la tabla con ese hash)
+    size_t ubicar(uint32_t hash, Valor valor) const {
+        size_t mascara = entradas.size() - 1;
+        size_t i = hash & mascara;
+        while (!(entradas[i].valor == valor)) {
+            i = (i + 1) & mascara;
+        }
+        return i;
+    }
+
+    // Cambiar cada valor ocupado por funcion(valor), sin mover las entradas
+    template <typename Funcion>
+    void reasignar(Funcion funcion) {
+        for (Entrada& entrada : entradas) {
+            if (!(entrada.valor == vacio)) {
+                entrada.valor = funcion(entrada.valor);
+            }
+        }
+    }
+
+    const Valor& operator[](size_t entrada) const { return entradas[entrada].valor; }
+
+    size_t obtenerTamanio() const { return ocupadas; }
+    size_t obtenerCapacidad() const { return entradas.size(); }
+    size_t obtenerBytesReservados() const { return entradas.capacity() * sizeof(Entrada); }
+};
+
+#endif // ESTRUCTURAS_LISTA_H
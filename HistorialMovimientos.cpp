@@ -0,0 +1,285 @@
+/**
+ * @file HistorialMovimientos.cpp
+ * @brief Implementación del historial compacto de jugadas.
+ */
+
+#include "HistorialMovimientos.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+bool empiezaCon(const std::string &linea, const std::string &prefijo) {
+  return linea.compare(0, prefijo.size(), prefijo) == 0;
+}
+
+// "[a|b]" en cualquier orden, o -1
+int leerFicha(const std::string &texto) {
+  if (texto.size() != 5 || texto[0] != '[' || texto[2] != '|' || texto[4] != ']' || texto[1] < '0' ||
+      texto[1] > '6' || texto[3] < '0' || texto[3] > '6') {
+    return -1;
+  }
+  return idFicha(texto[1] - '0', texto[3] - '0');
+}
+
+} // namespace
+
+HistorialMovimientos::HistorialMovimientos() : cabeza(nullptr), cola(nullptr), contador(0) {}
+
+HistorialMovimientos::~HistorialMovimientos() {
+  Bloque *actual = cabeza;
+  while (actual != nullptr) {
+    Bloque *siguiente = actual->siguiente;
+    delete actual;
+    actual = siguiente;
+  }
+}
+
+uint16_t HistorialMovimientos::codificar(const Jugada &jugada, bool abreTablero) {
+  return static_cast<uint16_t>(jugada.ficha | jugada.jugador << 5 | (jugada.lado == Lado::Derecha) << 7 |
+                               jugada.volteada << 8 | abreTablero << 9);
+}
+
+Jugada HistorialMovimientos::decodificar(uint16_t codigo) {
+  return Jugada{static_cast<int8_t>(codigo >> 5 & 3), static_cast<int8_t>(codigo & 31),
+                (codigo >> 7 & 1) ? Lado::Derecha : Lado::Izquierda, (codigo >> 8 & 1) != 0};
+}
+
+const std::string &HistorialMovimientos::nombreJugador(int jugador) const {
+  static std::string sinNombre[MAXIMO_JUGADORES] = {"Jugador 1", "Jugador 2", "Jugador 3", "Jugador 4"};
+  return jugador < static_cast<int>(nombres.size()) ? nombres[jugador] : sinNombre[jugador];
+}
+
+template <typename Visitante> void HistorialMovimientos::recorrer(Visitante visitar) const {
+  int numero = 0;
+  for (const Bloque *bloque = cabeza; bloque != nullptr; bloque = bloque->siguiente) {
+    for (int i = 0; i < JUGADAS_POR_BLOQUE && numero < contador; ++i) {
+      visitar(++numero, bloque->jugadas[i]);
+    }
+  }
+}
+
+void HistorialMovimientos::establecerNombres(const std::vector<std::string> &nombres) {
+  this->nombres = nombres;
+}
+
+void HistorialMovimientos::agregarMovimiento(const Jugada &jugada, bool abreTablero) {
+  agregarCodigo(codificar(jugada, abreTablero));
+}
+
+void HistorialMovimientos::agregarCodigo(uint16_t codigo) {
+  int posicion = contador % JUGADAS_POR_BLOQUE;
+  if (posicion == 0) {
+    Bloque *nuevoBloque = new Bloque;
+    nuevoBloque->siguiente = nullptr;
+    if (cabeza == nullptr) {
+      cabeza = cola = nuevoBloque;
+    } else {
+      cola->siguiente = nuevoBloque;
+      cola = nuevoBloque;
+    }
+  }
+  cola->jugadas[posicion] = codigo;
+  contador++;
+}
+
+int HistorialMovimientos::cargarDesdeArchivo(const std::string &nombreArchivo) {
+  std::ifstream archivo(nombreArchivo);
+  if (!archivo.is_open()) {
+    throw std::runtime_error("No se pudo abrir el archivo " + nombreArchivo);
+  }
+
+  // Se carga aparte y se agrega solo si todo el archivo es válido. Un asiento
+  // puede existir todavía sin nombre (definido[j] == false) si antes apareció
+  // uno mayor
+  std::vector<uint16_t> codigos;
+  std::vector<std::string> nombresCargados = nombres;
+  std::vector<bool> definido(nombres.size(), true);
+  auto error = [&](const std::string &motivo) {
+    return std::runtime_error("Historial inválido en " + nombreArchivo + " (movimiento " +
+                              std::to_string(codigos.size() + 1) + "): " + motivo);
+  };
+
+  std::string linea;
+  bool hayJugador = false;
+  std::string nombre;
+  int asiento = -1;
+  std::string tablero;
+  int ficha = -1;
+  int total = -1;
+  while (std::getline(archivo, linea)) {
+    if (!linea.empty() && linea.back() == '\r') {
+      linea.pop_back();
+    }
+    if (empiezaCon(linea, "Jugador:")) {
+      // El nombre puede estar vacío (y sin el espacio si un editor lo recortó)
+      hayJugador = true;
+      nombre = linea.size() > 9 ? linea.substr(9) : "";
+      asiento = -1;
+    } else if (empiezaCon(linea, "Asiento: ")) {
+      asiento = std::atoi(linea.c_str() + 9) - 1;
+      if (asiento < 0 || asiento >= MAXIMO_JUGADORES) {
+        throw error("asiento inválido " + linea.substr(9));
+      }
+    } else if (empiezaCon(linea, "Ficha jugada: ")) {
+      ficha = leerFicha(linea.substr(14));
+      if (ficha < 0) {
+        throw error("ficha inválida " + linea.substr(14));
+      }
+    } else if (empiezaCon(linea, "Estado del tablero: ")) {
+      if (ficha < 0 || !hayJugador) {
+        throw error("falta el jugador o la ficha");
+      }
+      // Con asiento el índice es ese; sin él (archivos anteriores), el del
+      // mismo nombre o el primero libre
+      size_t jugador = 0;
+      if (asiento >= 0) {
+        jugador = static_cast<size_t>(asiento);
+        if (jugador >= nombresCargados.size()) {
+          nombresCargados.resize(jugador + 1);
+          definido.resize(jugador + 1, false);
+        }
+      } else {
+        while (jugador < nombresCargados.size() && !(definido[jugador] && nombresCargados[jugador] == nombre)) {
+          jugador++;
+        }
+        if (jugador == nombresCargados.size()) {
+          jugador = 0;
+          while (jugador < definido.size() && definido[jugador]) {
+            jugador++;
+          }
+        }
+        if (jugador == MAXIMO_JUGADORES) {
+          throw error("más de " + std::to_string(MAXIMO_JUGADORES) + " jugadores");
+        }
+        if (jugador == nombresCargados.size()) {
+          nombresCargados.emplace_back();
+          definido.push_back(false);
+        }
+      }
+      if (!definido[jugador]) {
+        nombresCargados[jugador] = nombre;
+        definido[jugador] = true;
+      } else if (nombresCargados[jugador] != nombre) {
+        throw error("el jugador " + std::to_string(jugador + 1) + " aparece con dos nombres");
+      }
+
+      // El tablero nuevo es el anterior con la ficha a un lado, o solo la
+      // ficha si empieza otra partida
+      std::string nuevo = linea.substr(20);
+      Jugada jugada{static_cast<int8_t>(jugador), static_cast<int8_t>(ficha), Lado::Derecha, false};
+      std::string enTablero;
+      bool abre = nuevo.size() == 5;
+      bool continua = !tablero.empty() && nuevo.size() == tablero.size() + 5;
+      if (abre) {
+        enTablero = nuevo;
+      } else if (continua && nuevo.compare(5, std::string::npos, tablero) == 0) {
+        jugada.lado = Lado::Izquierda;
+        enTablero = nuevo.substr(0, 5);
+      } else if (continua && nuevo.compare(0, tablero.size(), tablero) == 0) {
+        enTablero = nuevo.substr(tablero.size());
+      } else {
+        throw error("el tablero no continúa el anterior");
+      }
+      if (leerFicha(enTablero) != ficha) {
+        throw error("la ficha del tablero no es la jugada");
+      }
+      jugada.volteada = enTablero != textoFicha(ficha);
+
+      codigos.push_back(codificar(jugada, abre));
+      tablero = nuevo;
+      hayJugador = false;
+      asiento = -1;
+      ficha = -1;
+    } else if (empiezaCon(linea, "Total de movimientos: ")) {
+      total = std::atoi(linea.c_str() + 22);
+    }
+  }
+  if (total >= 0 && total != static_cast<int>(codigos.size())) {
+    throw error("el total no coincide con los movimientos");
+  }
+
+  // Los asientos que quedaron sin nombre se muestran como "Jugador N"
+  for (size_t j = 0; j < nombresCargados.size(); ++j) {
+    if (!definido[j]) {
+      nombresCargados[j] = "Jugador " + std::to_string(j + 1);
+    }
+  }
+  nombres = nombresCargados;
+  for (uint16_t codigo : codigos) {
+    agregarCodigo(codigo);
+  }
+  return static_cast<int>(codigos.size());
+}
+
+size_t HistorialMovimientos::bytesUsados() const {
+  size_t bloques = (contador + JUGADAS_POR_BLOQUE - 1) / JUGADAS_POR_BLOQUE;
+  return sizeof(*this) + bloques * sizeof(Bloque);
+}
+
+void HistorialMovimientos::imprimirEnArchivo(const std::string &nombreArchivo) const {
+  std::ofstream archivo(nombreArchivo);
+
+  if (!archivo.is_open()) {
+    std::cerr << "Error: No se pudo crear el archivo " << nombreArchivo << std::endl;
+    return;
+  }
+
+  archivo << "========================================\n";
+  archivo << "   HISTORIAL DE PARTIDA DE DOMINÓ\n";
+  archivo << "========================================\n\n";
+
+  // El tablero se arma de nuevo jugada a jugada, agregando la ficha por su lado
+  std::string tablero;
+  recorrer([&](int numero, uint16_t codigo) {
+    Jugada jugada = decodificar(codigo);
+    if (abreTablero(codigo)) {
+      tablero.clear();
+    }
+    std::string enTablero = textoFicha(jugada.ficha, jugada.volteada);
+    if (jugada.lado == Lado::Izquierda) {
+      tablero.insert(0, enTablero);
+    } else {
+      tablero += enTablero;
+    }
+
+    archivo << "Movimiento #" << numero << "\n";
+    archivo << "----------------------------------------\n";
+    // El asiento va siempre: por nombre solo se sabría el orden de aparición
+    archivo << "Jugador: " << nombreJugador(jugada.jugador) << "\n";
+    archivo << "Asiento: " << jugada.jugador + 1 << "\n";
+    archivo << "Ficha jugada: " << textoFicha(jugada.ficha) << "\n";
+    archivo << "Estado del tablero: " << tablero << "\n\n";
+  });
+
+  archivo << "========================================\n";
+  archivo << "Total de movimientos: " << contador << "\n";
+  archivo << "========================================\n";
+
+  archivo.close();
+  std::cout << "✓ Historial guardado en " << nombreArchivo << std::endl;
+}
+
+void HistorialMovimientos::imprimirEnConsola() const {
+  std::cout << "\n========================================\n";
+  std::cout << "   HISTORIAL DE MOVIMIENTOS\n";
+  std::cout << "========================================\n\n";
+
+  const int maxMostrar = 10;
+  recorrer([&](int numero, uint16_t codigo) {
+    if (numero <= maxMostrar) {
+      Jugada jugada = decodificar(codigo);
+      std::cout << "Mov. #" << numero << ": " << nombreJugador(jugada.jugador) << " jugó "
+                << textoFicha(jugada.ficha) << "\n";
+    }
+  });
+
+  if (contador > maxMostrar) {
+    std::cout << "... y " << (contador - maxMostrar) << " movimientos más\n";
+  }
+
+  std::cout << "\nTotal: " << contador << " movimientos\n";
+  std::cout << "========================================\n";
+}
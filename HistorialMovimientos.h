@@ -0,0 +1,105 @@
+/**
+ * @file HistorialMovimientos.h
+ * @brief Historial de jugadas de dominó codificadas en 2 bytes (lista enlazada de bloques).
+ */
+
+#ifndef HISTORIAL_MOVIMIENTOS_H
+#define HISTORIAL_MOVIMIENTOS_H
+
+#include "MotorDomino.h"
+#include <string>
+#include <vector>
+
+/**
+ * @class HistorialMovimientos
+ * @brief Lista enlazada simple con el historial de jugadas de una o más partidas.
+ *
+ * Cada jugada ocupa 2 bytes: ficha (bits 0-4), jugador (bits 5-6), lado
+ * (bit 7), volteada (bit 8) y si abre un tablero vacío (bit 9, marca el
+ * comienzo de cada partida). Los nodos de la lista son bloques de
+ * JUGADAS_POR_BLOQUE jugadas, y los nombres se guardan una sola vez.
+ *
+ * El estado del tablero tras cada jugada no se guarda: se reconstruye al
+ * recorrer la lista cuando se imprime en archivo. Para moverse por una
+ * partida grabada está ReproductorHistorial.
+ */
+class HistorialMovimientos {
+public:
+  static constexpr int JUGADAS_POR_BLOQUE = 32;
+
+private:
+  struct Bloque {
+    uint16_t jugadas[JUGADAS_POR_BLOQUE];
+    Bloque *siguiente;
+  };
+
+  Bloque *cabeza;
+  Bloque *cola;
+  int contador;
+  std::vector<std::string> nombres;
+
+  friend class ReproductorHistorial;
+
+  static uint16_t codificar(const Jugada &jugada, bool abreTablero);
+  static Jugada decodificar(uint16_t codigo);
+  static bool abreTablero(uint16_t codigo) { return codigo >> 9 & 1; }
+
+  void agregarCodigo(uint16_t codigo);
+
+  /// Llama a visitar(numeroMovimiento, codigo) para cada jugada en orden
+  template <typename Visitante> void recorrer(Visitante visitar) const;
+
+public:
+  HistorialMovimientos();
+  ~HistorialMovimientos();
+  HistorialMovimientos(const HistorialMovimientos &) = delete;
+  HistorialMovimientos &operator=(const HistorialMovimientos &) = delete;
+
+  /// Nombres por índice de jugador (los que falten se muestran como "Jugador N")
+  void establecerNombres(const std::vector<std::string> &nombres);
+
+  /// abreTablero: la jugada es la primera de una partida
+  void agregarMovimiento(const Jugada &jugada, bool abreTablero);
+
+  /**
+   * Agrega al final las jugadas de un archivo escrito con imprimirEnArchivo.
+   * El lado y la orientación de cada ficha se deducen comparando cada estado
+   * del tablero con el anterior. Cada jugada se asigna al asiento de su línea
+   * "Asiento: N"; en archivos sin esa línea, al jugador del mismo nombre (que
+   * puede estar vacío) o al primer asiento libre.
+   * Devuelve la cantidad de jugadas cargadas; lanza std::runtime_error si el
+   * archivo no se puede abrir o no es un historial válido (y no agrega nada).
+   */
+  int cargarDesdeArchivo(const std::string &nombreArchivo);
+
+  int obtenerCantidad() const { return contador; }
+  const std::string &nombreJugador(int jugador) const;
+  size_t bytesUsados() const;
+
+  void imprimirEnArchivo(const std::string &nombreArchivo) const;
+  void imprimirEnConsola() const;
+};
+
+/**
+ * Observador que anota en un historial cada jugada del motor. La primera jugada
+ * después de alIniciar marca el comienzo de una partida. Si la partida empieza
+ * con fichas en la mesa (MotorDomino::jugarDesde), el historial no las conoce:
+ * su tablero arranca con la primera ficha jugada desde ahí.
+ */
+class ObservadorHistorial : public ObservadorDomino {
+private:
+  HistorialMovimientos &historial;
+  bool comienzaPartida = false;
+
+public:
+  explicit ObservadorHistorial(HistorialMovimientos &historial) : historial(historial) {}
+
+  void alIniciar(const EstadoDomino &) override { comienzaPartida = true; }
+
+  void alJugar(const EstadoDomino &, const Jugada &jugada) override {
+    historial.agregarMovimiento(jugada, comienzaPartida);
+    comienzaPartida = false;
+  }
+};
+
+#endif // HISTORIAL_MOVIMIENTOS_H
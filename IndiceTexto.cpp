@@ -0,0 +1,246 @@
+#include "IndiceTexto.h"
+#include <algorithm>
+
+namespace {
+
+// Minúscula sin tilde de U+00C0..U+00FF (Latin-1); conserva las letras sin base ASCII
+const char32_t PLEGADO_LATIN1[64] = {
+    U'a', U'a', U'a', U'a', U'a', U'a', U'æ', U'c', // ÀÁÂÃÄÅÆÇ
+    U'e', U'e', U'e', U'e', U'i', U'i', U'i', U'i', // ÈÉÊËÌÍÎÏ
+    U'ð', U'n', U'o', U'o', U'o', U'o', U'o', U'×', // ÐÑÒÓÔÕÖ×
+    U'o', U'u', U'u', U'u', U'u', U'y', U'þ', U'ß', // ØÙÚÛÜÝÞß
+    U'a', U'a', U'a', U'a', U'a', U'a', U'æ', U'c', // àáâãäåæç
+    U'e', U'e', U'e', U'e', U'i', U'i', U'i', U'i', // èéêëìíîï
+    U'ð', U'n', U'o', U'o', U'o', U'o', U'o', U'÷', // ðñòóôõö÷
+    U'o', U'u', U'u', U'u', U'u', U'y', U'þ', U'y'  // øùúûüýþÿ
+};
+
+const char32_t REEMPLAZO = U'\uFFFD';
+
+char32_t plegar(char32_t c) {
+    if (c >= U'A' && c <= U'Z') {
+        return c + (U'a' - U'A');
+    }
+    if (c >= 0xC0 && c <= 0xFF) {
+        return PLEGADO_LATIN1[c - 0xC0];
+    }
+    return c;
+}
+
+// Tres puntos de código (21 bits cada uno) en un entero
+uint64_t empaquetar(char32_t a, char32_t b, char32_t c) {
+    return (uint64_t(a) << 42) | (uint64_t(b) << 21) | uint64_t(c);
+}
+
+// Trigramas distintos del texto, ordenados
+void agregarTrigramas(const std::u32string& texto, std::vector<uint64_t>& trigramas) {
+    for (size_t i = 0; i + 3 <= texto.size(); i++) {
+        trigramas.push_back(empaquetar(texto[i], texto[i + 1], texto[i + 2]));
+    }
+}
+
+// Intersección de dos listas ordenadas; si una es mucho más larga se avanza en
+// ella con búsqueda binaria en lugar de recorrerla entera
+void intersectar(std::vector<uint32_t>& resultado, const std::vector<uint32_t>& otra) {
+    size_t destino = 0;
+    auto cursor = otra.begin();
+    bool saltar = otra.size() > resultado.size() * 16;
+    for (uint32_t documento : resultado) {
+        if (saltar) {
+            cursor = std::lower_bound(cursor, otra.end(), documento);
+        } else {
+            while (cursor != otra.end() && *cursor < documento) {
+                ++cursor;
+            }
+        }
+        if (cursor == otra.end()) {
+            break;
+        }
+        if (*cursor == documento) {
+            resultado[destino++] = documento;
+        }
+    }
+    resultado.resize(destino);
+}
+
+} // namespace
+
+IndiceTexto::IndiceTexto() : vivos(0) {}
+
+// Decodificación UTF-8 con validación (secuencias largas de más, sustitutos y
+// valores fuera de rango se reemplazan)
+std::u32string IndiceTexto::normalizar(std::string_view texto) {
+    std::u32string resultado;
+    resultado.reserve(texto.size());
+
+    size_t i = 0;
+    while (i < texto.size()) {
+        unsigned char b = static_cast<unsigned char>(texto[i]);
+        char32_t punto;
+        size_t largo;
+        char32_t minimo;
+        if (b < 0x80) {
+            resultado.push_back(plegar(b));
+            i++;
+            continue;
+        } else if ((b & 0xE0) == 0xC0) {
+            punto = b & 0x1F;
+            largo = 2;
+            minimo = 0x80;
+        } else if ((b & 0xF0) == 0xE0) {
+            punto = b & 0x0F;
+            largo = 3;
+            minimo = 0x800;
+        } else if ((b & 0xF8) == 0xF0) {
+            punto = b & 0x07;
+            largo = 4;
+            minimo = 0x10000;
+        } else {
+            resultado.push_back(REEMPLAZO);
+            i++;
+            continue;
+        }
+
+        size_t j = 1;
+        for (; j < largo && i + j < texto.size(); j++) {
+            unsigned char continuacion = static_cast<unsigned char>(texto[i + j]);
+            if ((continuacion & 0xC0) != 0x80) {
+                break;
+            }
+            punto = (punto << 6) | (continuacion & 0x3F);
+        }
+        if (j < largo || punto < minimo || punto > 0x10FFFF || (punto >= 0xD800 && punto <= 0xDFFF)) {
+            resultado.push_back(REEMPLAZO);
+            i += j; // Saltar solo los bytes consumidos
+            continue;
+        }
+        resultado.push_back(plegar(punto));
+        i += largo;
+    }
+    return resultado;
+}
+
+// Nombre y email se indexan juntos, separados por un salto de línea
+void IndiceTexto::agregar(Manejador manejador, std::string_view nombre, std::string_view email) {
+    uint32_t documento = static_cast<uint32_t>(documentos.size());
+    documentos.push_back(manejador);
+    if (manejador.indice >= documentoDeRanura.size()) {
+        documentoDeRanura.resize(manejador.indice + 1, UINT32_MAX);
+    }
+    documentoDeRanura[manejador.indice] = documento;
+    vivos++;
+
+    std::u32string texto = normalizar(nombre);
+    texto.push_back(U'\n');
+    texto += normalizar(email);
+
+    std::vector<uint64_t> trigramas;
+    agregarTrigramas(texto, trigramas);
+    std::sort(trigramas.begin(), trigramas.end());
+    trigramas.erase(std::unique(trigramas.begin(), trigramas.end()), trigramas.end());
+
+    for (uint64_t trigrama : trigramas) {
+        listas[trigrama].push_back(documento);
+    }
+}
+
+void IndiceTexto::quitar(Manejador manejador) {
+    if (manejador.indice >= documentoDeRanura.size()) {
+        return;
+    }
+    uint32_t documento = documentoDeRanura[manejador.indice];
+    if (documento >= documentos.size() || documentos[documento] != manejador) {
+        return;
+    }
+    documentos[documento] = Manejador::invalido();
+    documentoDeRanura[manejador.indice] = UINT32_MAX;
+    vivos--;
+
+    size_t muertos = documentos.size() - vivos;
+    if (muertos > 1024 && muertos > vivos) {
+        compactar();
+    }
+}
+
+// La renumeración conserva el orden, así las listas siguen ordenadas
+void IndiceTexto::compactar() {
+    std::vector<uint32_t> nuevoNumero(documentos.size(), UINT32_MAX);
+    std::vector<Manejador> compactados;
+    compactados.reserve(vivos);
+    for (uint32_t d = 0; d < documentos.size(); d++) {
+        if (documentos[d].esValido()) {
+            nuevoNumero[d] = static_cast<uint32_t>(compactados.size());
+            documentoDeRanura[documentos[d].indice] = nuevoNumero[d];
+            compactados.push_back(documentos[d]);
+        }
+    }
+    documentos.swap(compactados);
+
+    for (auto it = listas.begin(); it != listas.end();) {
+        std::vector<uint32_t>& lista = it->second;
+        size_t destino = 0;
+        for (uint32_t documento : lista) {
+            if (nuevoNumero[documento] != UINT32_MAX) {
+                lista[destino++] = nuevoNumero[documento];
+            }
+        }
+        lista.resize(destino);
+        if (lista.empty()) {
+            it = listas.erase(it);
+        } else {
+            lista.shrink_to_fit();
+            ++it;
+        }
+    }
+}
+
+void IndiceTexto::limpiar() {
+    documentos.clear();
+    documentoDeRanura.clear();
+    listas.clear();
+    vivos = 0;
+}
+
+// Intersección de las listas de todos los trigramas, de la más corta a la más larga
+std::vector<Manejador> IndiceTexto::candidatos(const std::u32string& consulta) const {
+    std::vector<Manejador> resultado;
+
+    if (consulta.size() < 3) {
+        resultado.reserve(vivos);
+        for (const Manejador& manejador : documentos) {
+            if (manejador.esValido()) {
+                resultado.push_back(manejador);
+            }
+        }
+        return resultado;
+    }
+
+    std::vector<uint64_t> trigramas;
+    agregarTrigramas(consulta, trigramas);
+    std::sort(trigramas.begin(), trigramas.end());
+    trigramas.erase(std::unique(trigramas.begin(), trigramas.end()), trigramas.end());
+
+    std::vector<const std::vector<uint32_t>*> seleccion;
+    for (uint64_t trigrama : trigramas) {
+        auto it = listas.find(trigrama);
+        if (it == listas.end()) {
+            return resultado; // Algún trigrama no aparece en ningún documento
+        }
+        seleccion.push_back(&it->second);
+    }
+    std::sort(seleccion.begin(), seleccion.end(),
+              [](const std::vector<uint32_t>* a, const std::vector<uint32_t>* b) { return a->size() < b->size(); });
+
+    std::vector<uint32_t> comunes = *seleccion[0];
+    for (size_t i = 1; i < seleccion.size() && !comunes.empty(); i++) {
+        intersectar(comunes, *seleccion[i]);
+    }
+
+    resultado.reserve(comunes.size());
+    for (uint32_t documento : comunes) {
+        if (documentos[documento].esValido()) {
+            resultado.push_back(documentos[documento]);
+        }
+    }
+    return resultado;
+}
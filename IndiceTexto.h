@@ -0,0 +1,56 @@
+#ifndef INDICE_TEXTO_H
+#define INDICE_TEXTO_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "AlmacenRanuras.h"
+
+// Clase IndiceTexto - Índice invertido de trigramas para búsquedas por subcadena
+// El texto se decodifica como UTF-8 y se normaliza por punto de código: minúsculas
+// y sin tildes en el rango Latin-1 ("Rodríguez" y "RODRIGUEZ" dan "rodriguez").
+// Cada trigrama (tres puntos de código) guarda la lista de documentos que lo
+// contienen. Los documentos se numeran en orden de alta, así cada lista queda
+// ordenada y las intersecciones son lineales.
+//
+// El índice devuelve candidatos: documentos que contienen todos los trigramas de
+// la consulta. Quien lo usa debe verificar la coincidencia sobre el texto real.
+class IndiceTexto {
+private:
+    // Manejador de cada documento (inválido si se quitó)
+    std::vector<Manejador> documentos;
+
+    // Documento de cada ranura del almacén (para quitar en O(1))
+    std::vector<uint32_t> documentoDeRanura;
+
+    std::unordered_map<uint64_t, std::vector<uint32_t>> listas;
+    size_t vivos;
+
+    // Quitar los documentos eliminados de todas las listas y renumerar
+    void compactar();
+
+public:
+    IndiceTexto();
+
+    // Agregar un documento con los textos dados (O(largo))
+    void agregar(Manejador manejador, std::string_view nombre, std::string_view email);
+
+    // Quitar un documento (O(1); las listas se depuran de forma perezosa)
+    void quitar(Manejador manejador);
+
+    void limpiar();
+
+    // Documentos candidatos para la consulta ya normalizada, en orden de alta.
+    // Si la consulta tiene menos de 3 puntos de código devuelve todos.
+    std::vector<Manejador> candidatos(const std::u32string& consulta) const;
+
+    size_t obtenerCantidadTrigramas() const { return listas.size(); }
+
+    // Decodificar UTF-8 y normalizar (minúsculas, sin tildes Latin-1).
+    // Los bytes inválidos se reemplazan por U+FFFD.
+    static std::u32string normalizar(std::string_view texto);
+};
+
+#endif // INDICE_TEXTO_H
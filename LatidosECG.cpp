@@ -0,0 +1,204 @@
+#include "LatidosECG.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define LATIDOS_ECG_X86 1
+#endif
+
+namespace {
+
+// Sumas que necesita la correlación de Pearson contra una plantilla centrada:
+// sx = Σx, sxx = Σx², sxy = Σx·y. n debe ser múltiplo de 4.
+struct Sumas {
+    double sx;
+    double sxx;
+    double sxy;
+};
+
+// Versión escalar con cuatro acumuladores independientes
+Sumas sumasEscalar(const double* x, const double* y, size_t n) {
+    double sx[4] = {0.0, 0.0, 0.0, 0.0};
+    double sxx[4] = {0.0, 0.0, 0.0, 0.0};
+    double sxy[4] = {0.0, 0.0, 0.0, 0.0};
+    for (size_t i = 0; i < n; i += 4) {
+        for (size_t j = 0; j < 4; j++) {
+            sx[j] += x[i + j];
+            sxx[j] += x[i + j] * x[i + j];
+            sxy[j] += x[i + j] * y[i + j];
+        }
+    }
+    return {sx[0] + sx[1] + sx[2] + sx[3],
+            sxx[0] + sxx[1] + sxx[2] + sxx[3],
+            sxy[0] + sxy[1] + sxy[2] + sxy[3]};
+}
+
+#ifdef LATIDOS_ECG_X86
+__attribute__((target("avx2,fma")))
+double sumaHorizontal(__m256d v) {
+    __m128d bajo = _mm256_castpd256_pd128(v);
+    __m128d alto = _mm256_extractf128_pd(v, 1);
+    bajo = _mm_add_pd(bajo, alto);
+    __m128d par = _mm_unpackhi_pd(bajo, bajo);
+    return _mm_cvtsd_f64(_mm_add_sd(bajo, par));
+}
+
+// Versión AVX2: las tres sumas se acumulan en el mismo recorrido con FMA
+__attribute__((target("avx2,fma")))
+Sumas sumasAVX2(const double* x, const double* y, size_t n) {
+    __m256d vsx = _mm256_setzero_pd();
+    __m256d vsxx = _mm256_setzero_pd();
+    __m256d vsxy = _mm256_setzero_pd();
+    for (size_t i = 0; i < n; i += 4) {
+        __m256d vx = _mm256_loadu_pd(x + i);
+        __m256d vy = _mm256_loadu_pd(y + i);
+        vsx = _mm256_add_pd(vsx, vx);
+        vsxx = _mm256_fmadd_pd(vx, vx, vsxx);
+        vsxy = _mm256_fmadd_pd(vx, vy, vsxy);
+    }
+    return {sumaHorizontal(vsx), sumaHorizontal(vsxx), sumaHorizontal(vsxy)};
+}
+#endif
+
+// Selección del núcleo una sola vez según la CPU
+using NucleoSumas = Sumas (*)(const double*, const double*, size_t);
+
+NucleoSumas seleccionarNucleo() {
+#ifdef LATIDOS_ECG_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return sumasAVX2;
+    }
+#endif
+    return sumasEscalar;
+}
+
+const NucleoSumas nucleoSumas = seleccionarNucleo();
+
+} // namespace
+
+// Constructor - define el tamaño de la ventana de cada latido
+LatidosECG::LatidosECG(int muestrasAntes, int muestrasDespues)
+    : muestrasAntes(std::max(muestrasAntes, 0)),
+      muestrasDespues(std::max(muestrasDespues, 0)) {
+    longitud = static_cast<size_t>(this->muestrasAntes + 1 + this->muestrasDespues);
+    paso = (longitud + 3) & ~static_cast<size_t>(3);
+}
+
+// Extraer una ventana por pico, alineada en el máximo local más cercano
+size_t LatidosECG::extraer(const std::vector<double>& amplitudes, const std::vector<int>& picos,
+                           int radioAlineacion) {
+    ventanas.clear();
+    indicesPicos.clear();
+    plantilla.clear();
+    correlaciones.clear();
+    ventanas.reserve(picos.size() * paso);
+    indicesPicos.reserve(picos.size());
+
+    const int total = static_cast<int>(amplitudes.size());
+    int ultimoPico = -1;
+
+    for (int pico : picos) {
+        // Reajustar el pico al máximo de la señal en la vecindad
+        int desde = std::max(0, pico - radioAlineacion);
+        int hasta = std::min(total - 1, pico + radioAlineacion);
+        if (desde > hasta) {
+            continue;
+        }
+        int alineado = desde;
+        for (int i = desde + 1; i <= hasta; i++) {
+            if (amplitudes[i] > amplitudes[alineado]) {
+                alineado = i;
+            }
+        }
+
+        // Descartar latidos incompletos y picos repetidos tras la alineación
+        if (alineado - muestrasAntes < 0 || alineado + muestrasDespues >= total ||
+            alineado == ultimoPico) {
+            continue;
+        }
+        ultimoPico = alineado;
+
+        const double* origen = amplitudes.data() + (alineado - muestrasAntes);
+        ventanas.insert(ventanas.end(), origen, origen + longitud);
+        ventanas.resize(ventanas.size() + (paso - longitud), 0.0);
+        indicesPicos.push_back(alineado);
+    }
+
+    return indicesPicos.size();
+}
+
+// Plantilla = promedio muestra a muestra de todos los latidos, centrada en cero
+const std::vector<double>& LatidosECG::construirPlantilla() {
+    plantilla.assign(paso, 0.0);
+    size_t cantidad = obtenerCantidad();
+    if (cantidad == 0) {
+        return plantilla;
+    }
+
+    for (size_t b = 0; b < cantidad; b++) {
+        const double* latido = obtenerLatido(b);
+        for (size_t i = 0; i < paso; i++) {
+            plantilla[i] += latido[i];
+        }
+    }
+
+    double media = 0.0;
+    for (size_t i = 0; i < longitud; i++) {
+        plantilla[i] /= static_cast<double>(cantidad);
+        media += plantilla[i];
+    }
+    media /= static_cast<double>(longitud);
+
+    // Centrar solo las muestras reales; el relleno queda en cero
+    for (size_t i = 0; i < longitud; i++) {
+        plantilla[i] -= media;
+    }
+
+    return plantilla;
+}
+
+// r = Σx·y / sqrt((Σx² - (Σx)²/n) · Σy²), con y centrada (Σy = 0)
+const std::vector<double>& LatidosECG::calcularCorrelaciones() {
+    if (plantilla.size() != paso) {
+        construirPlantilla();
+    }
+
+    double syy = 0.0;
+    for (size_t i = 0; i < longitud; i++) {
+        syy += plantilla[i] * plantilla[i];
+    }
+
+    size_t cantidad = obtenerCantidad();
+    correlaciones.assign(cantidad, 0.0);
+    const double n = static_cast<double>(longitud);
+
+    for (size_t b = 0; b < cantidad; b++) {
+        Sumas s = nucleoSumas(obtenerLatido(b), plantilla.data(), paso);
+        double varianzaX = s.sxx - s.sx * s.sx / n;
+        double denominador = std::sqrt(varianzaX * syy);
+        correlaciones[b] = denominador > 0.0 ? s.sxy / denominador : 0.0;
+    }
+
+    return correlaciones;
+}
+
+// Latidos cuya morfología se aparta de la plantilla
+std::vector<size_t> LatidosECG::detectarEctopicos(double umbralCorrelacion) const {
+    std::vector<size_t> ectopicos;
+    for (size_t b = 0; b < correlaciones.size(); b++) {
+        if (correlaciones[b] < umbralCorrelacion) {
+            ectopicos.push_back(b);
+        }
+    }
+    return ectopicos;
+}
+
+bool LatidosECG::usaAVX2() {
+#ifdef LATIDOS_ECG_X86
+    return nucleoSumas == sumasAVX2;
+#else
+    return false;
+#endif
+}
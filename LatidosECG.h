@@ -0,0 +1,52 @@
+#ifndef LATIDOS_ECG_H
+#define LATIDOS_ECG_H
+
+#include <cstddef>
+#include <vector>
+
+// Clase LatidosECG - Segmentación de latidos y comparación con una plantilla
+// Cada latido se guarda como una ventana de longitud fija alineada en su pico R.
+// Las ventanas están contiguas en memoria (una fila por latido) y rellenadas con
+// ceros hasta un múltiplo de 4 para que el núcleo AVX2 no necesite casos de borde.
+class LatidosECG {
+private:
+    int muestrasAntes;
+    int muestrasDespues;
+    size_t longitud;  // Muestras reales por latido
+    size_t paso;      // Longitud rellenada (múltiplo de 4)
+
+    std::vector<double> ventanas;       // cantidad * paso
+    std::vector<int> indicesPicos;      // Pico R (ya alineado) de cada latido
+    std::vector<double> plantilla;      // Plantilla centrada (media cero), rellenada
+    std::vector<double> correlaciones;  // Correlación de cada latido con la plantilla
+
+public:
+    // Constructor (ventana de muestrasAntes + 1 + muestrasDespues muestras)
+    LatidosECG(int muestrasAntes, int muestrasDespues);
+
+    // Extraer latidos alrededor de cada pico; el pico se reajusta al máximo local
+    // de la señal dentro de +/- radioAlineacion muestras. Los latidos que no caben
+    // completos en la señal se descartan. Devuelve la cantidad de latidos.
+    size_t extraer(const std::vector<double>& amplitudes, const std::vector<int>& picos,
+                   int radioAlineacion = 10);
+
+    // Construir la plantilla promedio de todos los latidos
+    const std::vector<double>& construirPlantilla();
+
+    // Correlación de Pearson de cada latido con la plantilla (núcleo AVX2 si existe)
+    const std::vector<double>& calcularCorrelaciones();
+
+    // Índices de los latidos con correlación menor al umbral (posibles ectópicos)
+    std::vector<size_t> detectarEctopicos(double umbralCorrelacion = 0.9) const;
+
+    // Métodos auxiliares
+    size_t obtenerCantidad() const { return indicesPicos.size(); }
+    size_t obtenerLongitud() const { return longitud; }
+    int obtenerIndicePico(size_t latido) const { return indicesPicos[latido]; }
+    const double* obtenerLatido(size_t latido) const { return ventanas.data() + latido * paso; }
+
+    // Indica si las correlaciones se calculan con instrucciones AVX2
+    static bool usaAVX2();
+};
+
+#endif // LATIDOS_ECG_H
@@ -1,167 +1,605 @@
 #include "ListadoEstudiantil.h"
-#include <fstream>
+#include "ArchivoRoster.h"
 #include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <utility>
 
 // Constructor - inicializa una lista vacía
-ListadoEstudiantil::ListadoEstudiantil() : cabeza(nullptr), tamanio(0) {}
+ListadoEstudiantil::ListadoEstudiantil()
+    : huecos(0), tamanio(0), indiceIds(Manejador::invalido()), indicesOrdenados(false), indices(nullptr),
+      textoIndexado(false) {}
 
-// Destructor - libera la memoria asignada dinámicamente
-ListadoEstudiantil::~ListadoEstudiantil() {
-    Nodo* actual = cabeza;
-    while (actual != nullptr) {
-        Nodo* siguiente = actual->siguiente;
-        delete actual->estudiante;
-        delete actual;
-        actual = siguiente;
+// Constructor con un recurso externo para los nodos de los índices ordenados
+ListadoEstudiantil::ListadoEstudiantil(std::pmr::memory_resource* recursoIndices)
+    : huecos(0), tamanio(0), indiceIds(Manejador::invalido()), indicesOrdenados(false), indices(recursoIndices),
+      textoIndexado(false) {}
+
+// Sin excepciones al mover: std::vector<ListadoEstudiantil> mueve al crecer
+static_assert(std::is_nothrow_move_constructible<ListadoEstudiantil>::value,
+              "ListadoEstudiantil debe poder moverse sin excepciones");
+
+// Mover: los vectores y el bloque de índices pasan sin copiarse y la lista de
+// origen queda vacía (con contadores en cero, lista para reutilizarse)
+ListadoEstudiantil::ListadoEstudiantil(ListadoEstudiantil&& otra) noexcept
+    : almacen(std::move(otra.almacen)), orden(std::move(otra.orden)),
+      ordinalDeRanura(std::move(otra.ordinalDeRanura)), fenwick(std::move(otra.fenwick)),
+      huecos(std::exchange(otra.huecos, 0)), tamanio(std::exchange(otra.tamanio, 0)),
+      indiceIds(std::move(otra.indiceIds)),
+      indicesOrdenados(std::exchange(otra.indicesOrdenados, false)), indices(std::move(otra.indices)),
+      columnaAnio(std::move(otra.columnaAnio)), columnaPromedio(std::move(otra.columnaPromedio)),
+      filasOcupadas(std::move(otra.filasOcupadas)), textoIndexado(std::exchange(otra.textoIndexado, false)),
+      indiceTexto(std::move(otra.indiceTexto)) {
+    otra.almacen = AlmacenRanuras<Estudiante>();
+    otra.orden.clear();
+    otra.ordinalDeRanura.clear();
+    otra.fenwick.limpiar();
+    otra.columnaAnio.clear();
+    otra.columnaPromedio.clear();
+    otra.filasOcupadas.clear();
+    otra.indiceTexto.limpiar();
+}
+
+ListadoEstudiantil& ListadoEstudiantil::operator=(ListadoEstudiantil&& otra) noexcept {
+    if (this != &otra) {
+        ListadoEstudiantil movida(std::move(otra));
+        almacen = std::move(movida.almacen);
+        orden = std::move(movida.orden);
+        ordinalDeRanura = std::move(movida.ordinalDeRanura);
+        fenwick = std::move(movida.fenwick);
+        huecos = movida.huecos;
+        tamanio = movida.tamanio;
+        indiceIds = std::move(movida.indiceIds);
+        indicesOrdenados = movida.indicesOrdenados;
+        indices = std::move(movida.indices);
+        columnaAnio = std::move(movida.columnaAnio);
+        columnaPromedio = std::move(movida.columnaPromedio);
+        filasOcupadas = std::move(movida.filasOcupadas);
+        textoIndexado = movida.textoIndexado;
+        indiceTexto = std::move(movida.indiceTexto);
     }
+    return *this;
 }
 
-// Insertar un nuevo nodo al final de la lista
-void ListadoEstudiantil::insertar(const Estudiante& estudiante) {
-    Estudiante* nuevoEstudiante = new Estudiante(estudiante);
-    Nodo* nuevoNodo = new Nodo(nuevoEstudiante);
+// Árboles vacíos: sin recurso externo se crea un pool propio
+ListadoEstudiantil::IndicesSecundarios::Arboles::Arboles(std::pmr::memory_resource* externo)
+    : propio(externo ? nullptr : new PoolNodos()),
+      promedio(externo ? externo : propio.get()), anio(externo ? externo : propio.get()) {}
+
+// El bloque de árboles se crea recién al habilitar los índices
+ListadoEstudiantil::IndicesSecundarios::IndicesSecundarios(std::pmr::memory_resource* externo)
+    : externo(externo) {}
+
+// La copia siempre recibe un pool propio: el recurso externo del original puede
+// no estar sincronizado, y la copia puede usarse desde otro hilo (por ejemplo
+// en las instantáneas de ListadoEstudiantilConcurrente)
+ListadoEstudiantil::IndicesSecundarios::IndicesSecundarios(const IndicesSecundarios& otro)
+    : externo(nullptr) {
+    if (otro.arboles) {
+        arboles.reset(new Arboles(nullptr));
+        arboles->promedio = otro.arboles->promedio;
+        arboles->anio = otro.arboles->anio;
+    }
+}
+
+// Mover pasa el bloque (pool y árboles juntos) sin asignar memoria; el origen
+// queda sin bloque y lo vuelve a crear si se habilitan sus índices
+ListadoEstudiantil::IndicesSecundarios::IndicesSecundarios(IndicesSecundarios&& otro) noexcept
+    : externo(otro.externo), arboles(std::move(otro.arboles)) {}
+
+// Los árboles conservan su recurso; solo se copian los elementos
+ListadoEstudiantil::IndicesSecundarios&
+ListadoEstudiantil::IndicesSecundarios::operator=(const IndicesSecundarios& otro) {
+    if (this == &otro) {
+        return *this;
+    }
+    if (!otro.arboles) {
+        limpiar();
+        return *this;
+    }
+    crear();
+    arboles->promedio = otro.arboles->promedio;
+    arboles->anio = otro.arboles->anio;
+    return *this;
+}
+
+// Intercambiar los bloques: cada árbol sigue junto al pool del que salieron sus nodos
+ListadoEstudiantil::IndicesSecundarios&
+ListadoEstudiantil::IndicesSecundarios::operator=(IndicesSecundarios&& otro) noexcept {
+    std::swap(externo, otro.externo);
+    std::swap(arboles, otro.arboles);
+    return *this;
+}
+
+void ListadoEstudiantil::IndicesSecundarios::crear() {
+    if (!arboles) {
+        arboles.reset(new Arboles(externo));
+    }
+}
+
+void ListadoEstudiantil::IndicesSecundarios::limpiar() {
+    if (!arboles) {
+        return;
+    }
+    arboles->promedio.clear();
+    arboles->anio.clear();
+    if (arboles->propio) {
+        arboles->propio->liberar();
+    }
+}
+
+// Quitar los huecos de 'orden'; después de compactar la posición lógica
+// coincide con la física y el árbol de Fenwick queda en unos
+void ListadoEstudiantil::compactar() {
+    size_t destino = 0;
+    for (size_t i = 0; i < orden.size(); i++) {
+        if (orden[i].esValido()) {
+            orden[destino] = orden[i];
+            columnaAnio[destino] = columnaAnio[i];
+            columnaPromedio[destino] = columnaPromedio[i];
+            ordinalDeRanura[orden[destino].indice] = static_cast<uint32_t>(destino);
+            destino++;
+        }
+    }
+    orden.resize(destino);
     
-    if (cabeza == nullptr) {
-        cabeza = nuevoNodo;
-    } else {
-        Nodo* actual = cabeza;
-        while (actual->siguiente != nullptr) {
-            actual = actual->siguiente;
+    // Las columnas se compactan igual; todas las filas quedan ocupadas
+    columnaAnio.resize(destino);
+    columnaPromedio.resize(destino);
+    filasOcupadas.assign((destino + 63) / 64, ~uint64_t(0));
+    if (destino % 64 != 0) {
+        filasOcupadas.back() = (uint64_t(1) << (destino % 64)) - 1;
+    }
+    
+    fenwick.llenar(static_cast<int>(destino));
+    huecos = 0;
+}
+
+// Hash del número de identificación (32 bits bastan para el índice y el filtro)
+uint32_t ListadoEstudiantil::hashId(const std::string& numeroIdentificacion) {
+    uint64_t h = std::hash<std::string>()(numeroIdentificacion);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<uint32_t>(h);
+}
+
+// Entre los registros con el mismo ID, el de menor posición es el primero de la lista
+long ListadoEstudiantil::primeraAparicion(const std::string& numeroIdentificacion) const {
+    long primera = -1;
+    uint32_t ordinalPrimera = 0;
+    indiceIds.recorrerGrupo(hashId(numeroIdentificacion), [&](size_t entrada, Manejador manejador) {
+        if (almacen[manejador].numeroIdentificacion != numeroIdentificacion) {
+            return;
+        }
+        uint32_t ordinal = ordinalDeRanura[manejador.indice];
+        if (primera == -1 || ordinal < ordinalPrimera) {
+            primera = static_cast<long>(entrada);
+            ordinalPrimera = ordinal;
         }
-        actual->siguiente = nuevoNodo;
+    });
+    return primera;
+}
+
+// Sin huecos la posición lógica es la física; con huecos se selecciona en el árbol
+int ListadoEstudiantil::posicionFisica(int indice) const {
+    return huecos == 0 ? indice : fenwick.seleccionar(indice);
+}
+
+// Insertar un nuevo registro al final de la lista (O(1) amortizado)
+void ListadoEstudiantil::insertar(const Estudiante& estudiante) {
+    insertar(Estudiante(estudiante));
+}
+
+void ListadoEstudiantil::insertar(Estudiante&& estudiante) {
+    uint32_t hash = hashId(estudiante.numeroIdentificacion);
+    Manejador manejador = almacen.insertar(std::move(estudiante));
+    indiceIds.insertar(hash, manejador);
+    
+    if (manejador.indice >= ordinalDeRanura.size()) {
+        ordinalDeRanura.resize(manejador.indice + 1);
+    }
+    size_t fila = orden.size();
+    ordinalDeRanura[manejador.indice] = static_cast<uint32_t>(fila);
+    orden.push_back(manejador);
+    
+    const Estudiante& registro = almacen[manejador];
+    columnaAnio.push_back(registro.anioNacimiento);
+    columnaPromedio.push_back(registro.promedioAcademico);
+    if (fila % 64 == 0) {
+        filasOcupadas.push_back(0);
+    }
+    filasOcupadas[fila / 64] |= uint64_t(1) << (fila % 64);
+    
+    fenwick.extender(huecos == 0);
+    
+    if (indicesOrdenados) {
+        indices.arboles->promedio.emplace(registro.promedioAcademico, manejador);
+        indices.arboles->anio.emplace(registro.anioNacimiento, manejador);
+    }
+    if (textoIndexado) {
+        indiceTexto.agregar(manejador, registro.nombreCompleto, registro.email);
     }
+    
     tamanio++;
 }
 
-// Eliminar un nodo con un valor específico (por número de identificación)
+// Insertar un lote moviendo los registros
+void ListadoEstudiantil::insertarLote(std::vector<Estudiante>&& estudiantes) {
+    insertarLote(std::make_move_iterator(estudiantes.begin()),
+                 std::make_move_iterator(estudiantes.end()));
+    estudiantes.clear();
+}
+
+// Insertar un lote copiando los registros
+void ListadoEstudiantil::insertarLote(const std::vector<Estudiante>& estudiantes) {
+    insertarLote(estudiantes.begin(), estudiantes.end());
+}
+
+// Reservar capacidad en todas las estructuras internas
+void ListadoEstudiantil::reservar(int cantidad) {
+    if (cantidad <= 0) {
+        return;
+    }
+    size_t n = static_cast<size_t>(cantidad);
+    almacen.reservar(n);
+    orden.reserve(n + static_cast<size_t>(huecos));
+    fenwick.reservar(n + static_cast<size_t>(huecos));
+    columnaAnio.reserve(n + static_cast<size_t>(huecos));
+    columnaPromedio.reserve(n + static_cast<size_t>(huecos));
+    ordinalDeRanura.reserve(n);
+    
+    // Tabla del índice con capacidad suficiente para no crecer durante el lote
+    indiceIds.reservar(n);
+}
+
+// Cargar un roster CSV al final de la lista
+int ListadoEstudiantil::cargarDesdeCSV(const std::string& nombreArchivo, int hilos) {
+    std::vector<Estudiante> estudiantes = leerRosterCSV(nombreArchivo, hilos);
+    int cantidad = static_cast<int>(estudiantes.size());
+    insertarLote(std::move(estudiantes));
+    return cantidad;
+}
+
+// Cargar un roster binario al final de la lista
+int ListadoEstudiantil::cargarDesdeBinario(const std::string& nombreArchivo) {
+    std::vector<Estudiante> estudiantes = leerRosterBinario(nombreArchivo);
+    int cantidad = static_cast<int>(estudiantes.size());
+    insertarLote(std::move(estudiantes));
+    return cantidad;
+}
+
+// Eliminar un registro con un valor específico (por número de identificación)
+// El índice localiza el registro; su posición en 'orden' queda como hueco
 bool ListadoEstudiantil::eliminar(const std::string& numeroIdentificacion) {
-    if (cabeza == nullptr) {
+    long entrada = primeraAparicion(numeroIdentificacion);
+    if (entrada == -1) {
         return false;
     }
     
-    // Caso especial: el nodo a eliminar es la cabeza
-    if (cabeza->estudiante->numeroIdentificacion == numeroIdentificacion) {
-        Nodo* temp = cabeza;
-        cabeza = cabeza->siguiente;
-        delete temp->estudiante;
-        delete temp;
-        tamanio--;
-        return true;
-    }
-    
-    // Buscar el nodo a eliminar
-    Nodo* actual = cabeza;
-    while (actual->siguiente != nullptr) {
-        if (actual->siguiente->estudiante->numeroIdentificacion == numeroIdentificacion) {
-            Nodo* temp = actual->siguiente;
-            actual->siguiente = temp->siguiente;
-            delete temp->estudiante;
-            delete temp;
-            tamanio--;
-            return true;
+    Manejador manejador = indiceIds[entrada];
+    uint32_t posicion = ordinalDeRanura[manejador.indice];
+    orden[posicion] = Manejador::invalido();
+    filasOcupadas[posicion / 64] &= ~(uint64_t(1) << (posicion % 64));
+    fenwick.agregar(static_cast<int>(posicion), -1);
+    huecos++;
+    
+    // Los huecos al final se descartan de inmediato
+    while (!orden.empty() && !orden.back().esValido()) {
+        orden.pop_back();
+        columnaAnio.pop_back();
+        columnaPromedio.pop_back();
+        fenwick.recortar();
+        huecos--;
+    }
+    filasOcupadas.resize((orden.size() + 63) / 64);
+    
+    indiceIds.quitar(static_cast<size_t>(entrada));
+    if (indicesOrdenados) {
+        const Estudiante& registro = almacen[manejador];
+        indices.arboles->promedio.erase({registro.promedioAcademico, manejador});
+        indices.arboles->anio.erase({registro.anioNacimiento, manejador});
+    }
+    if (textoIndexado) {
+        indiceTexto.quitar(manejador);
+    }
+    almacen.eliminar(manejador);
+    tamanio--;
+    
+    // Acotar la memoria ocupada por huecos (O(1) amortizado)
+    if (huecos > tamanio + 64) {
+        compactar();
+    }
+    return true;
+}
+
+// Reemplazar los datos de un registro: el ID cambia de entrada en la tabla hash,
+// las claves ordenadas se reinsertan, las columnas se reescriben en su fila y,
+// si cambió el nombre o el email, el registro se vuelve a indexar por texto
+bool ListadoEstudiantil::actualizar(Manejador manejador, const Estudiante& datos) {
+    Estudiante* registro = almacen.obtener(manejador);
+    if (registro == nullptr) {
+        return false;
+    }
+    
+    if (registro->numeroIdentificacion != datos.numeroIdentificacion) {
+        indiceIds.quitar(indiceIds.ubicar(hashId(registro->numeroIdentificacion), manejador));
+        indiceIds.insertar(hashId(datos.numeroIdentificacion), manejador);
+    }
+    
+    if (indicesOrdenados) {
+        if (registro->promedioAcademico != datos.promedioAcademico) {
+            indices.arboles->promedio.erase({registro->promedioAcademico, manejador});
+            indices.arboles->promedio.emplace(datos.promedioAcademico, manejador);
+        }
+        if (registro->anioNacimiento != datos.anioNacimiento) {
+            indices.arboles->anio.erase({registro->anioNacimiento, manejador});
+            indices.arboles->anio.emplace(datos.anioNacimiento, manejador);
         }
-        actual = actual->siguiente;
     }
     
-    return false;
+    uint32_t fila = ordinalDeRanura[manejador.indice];
+    columnaAnio[fila] = datos.anioNacimiento;
+    columnaPromedio[fila] = datos.promedioAcademico;
+    
+    bool textoCambia = textoIndexado && (registro->nombreCompleto != datos.nombreCompleto ||
+                                         registro->email != datos.email);
+    *registro = datos;
+    if (textoCambia) {
+        indiceTexto.quitar(manejador);
+        indiceTexto.agregar(manejador, registro->nombreCompleto, registro->email);
+    }
+    return true;
+}
+
+// Actualizar el registro con el ID dado que aparece primero en la lista
+bool ListadoEstudiantil::actualizar(const std::string& numeroIdentificacion, const Estudiante& datos) {
+    long entrada = primeraAparicion(numeroIdentificacion);
+    return entrada != -1 && actualizar(indiceIds[entrada], datos);
 }
 
 // Buscar un valor en la lista y devolver su posición
 int ListadoEstudiantil::buscar(const std::string& numeroIdentificacion) const {
-    Nodo* actual = cabeza;
-    int posicion = 0;
-    
-    while (actual != nullptr) {
-        if (actual->estudiante->numeroIdentificacion == numeroIdentificacion) {
-            return posicion;
+    long entrada = primeraAparicion(numeroIdentificacion);
+    if (entrada == -1) {
+        return -1; // No encontrado
+    }
+    int posicion = static_cast<int>(ordinalDeRanura[indiceIds[entrada].indice]);
+    return huecos == 0 ? posicion : fenwick.prefijo(posicion);
+}
+
+// Manejador estable del registro con el ID dado
+Manejador ListadoEstudiantil::obtenerManejador(const std::string& numeroIdentificacion) const {
+    long entrada = primeraAparicion(numeroIdentificacion);
+    return entrada == -1 ? Manejador::invalido() : indiceIds[entrada];
+}
+
+// Construir los índices ordenados a partir de los registros actuales
+void ListadoEstudiantil::habilitarIndicesOrdenados() {
+    if (indicesOrdenados) {
+        return;
+    }
+    indices.crear();
+    indices.limpiar();
+    for (const Manejador& manejador : orden) {
+        if (manejador.esValido()) {
+            indices.arboles->promedio.emplace(almacen[manejador].promedioAcademico, manejador);
+            indices.arboles->anio.emplace(almacen[manejador].anioNacimiento, manejador);
         }
-        actual = actual->siguiente;
-        posicion++;
     }
-    
-    return -1; // No encontrado
+    indicesOrdenados = true;
 }
 
-// Imprimir todos los elementos de la lista en un archivo de texto
-void ListadoEstudiantil::imprimirEnArchivo(const std::string& nombreArchivo) const {
-    std::ofstream archivo(nombreArchivo);
-    
-    if (!archivo.is_open()) {
-        throw std::runtime_error("No se pudo abrir el archivo para escritura");
+// Liberar los índices ordenados y sus páginas (las consultas vuelven a recorrer la lista)
+void ListadoEstudiantil::deshabilitarIndicesOrdenados() {
+    indices.limpiar();
+    indicesOrdenados = false;
+}
+
+namespace {
+
+// Pares (clave, manejador) en [minimo, maximo], en el mismo orden que el índice
+template <typename Clave, typename Indice>
+std::vector<Manejador> rangoEnIndice(const Indice& indice, Clave minimo, Clave maximo) {
+    std::vector<Manejador> resultado;
+    if (!(minimo <= maximo)) {
+        return resultado;
     }
-    
-    archivo << "========================================\n";
-    archivo << "     LISTADO DE ESTUDIANTES\n";
-    archivo << "========================================\n\n";
-    
-    Nodo* actual = cabeza;
-    int contador = 1;
-    
-    while (actual != nullptr) {
-        archivo << "Estudiante #" << contador << "\n";
-        archivo << "----------------------------------------\n";
-        archivo << "Nombre Completo: " << actual->estudiante->nombreCompleto << "\n";
-        archivo << "Año de Nacimiento: " << actual->estudiante->anioNacimiento << "\n";
-        archivo << "Número de Identificación: " << actual->estudiante->numeroIdentificacion << "\n";
-        archivo << "Promedio Académico: " << actual->estudiante->promedioAcademico << "\n";
-        archivo << "Email: " << actual->estudiante->email << "\n\n";
-        
-        actual = actual->siguiente;
-        contador++;
+    auto desde = indice.lower_bound({minimo, Manejador{0, 0}});
+    auto hasta = indice.upper_bound({maximo, Manejador{UINT32_MAX, UINT32_MAX}});
+    for (auto it = desde; it != hasta; ++it) {
+        resultado.push_back(it->second);
+    }
+    return resultado;
+}
+
+// Versión sin índice: filtrar y ordenar igual que lo haría el índice
+template <typename Clave>
+std::vector<Manejador> ordenarPares(std::vector<std::pair<Clave, Manejador>>& pares) {
+    std::sort(pares.begin(), pares.end());
+    std::vector<Manejador> resultado;
+    resultado.reserve(pares.size());
+    for (const auto& par : pares) {
+        resultado.push_back(par.second);
+    }
+    return resultado;
+}
+
+} // namespace
+
+// Estudiantes con promedio en [minimo, maximo]
+std::vector<Manejador> ListadoEstudiantil::rangoPromedio(double minimo, double maximo) const {
+    if (indicesOrdenados) {
+        return rangoEnIndice(indices.arboles->promedio, minimo, maximo);
+    }
+    std::vector<std::pair<double, Manejador>> pares;
+    for (const Manejador& manejador : orden) {
+        if (manejador.esValido()) {
+            double promedio = almacen[manejador].promedioAcademico;
+            if (promedio >= minimo && promedio <= maximo) {
+                pares.emplace_back(promedio, manejador);
+            }
+        }
+    }
+    return ordenarPares(pares);
+}
+
+// Estudiantes nacidos entre 'desde' y 'hasta'
+std::vector<Manejador> ListadoEstudiantil::rangoAnio(int desde, int hasta) const {
+    if (indicesOrdenados) {
+        return rangoEnIndice(indices.arboles->anio, desde, hasta);
+    }
+    std::vector<std::pair<int, Manejador>> pares;
+    for (const Manejador& manejador : orden) {
+        if (manejador.esValido()) {
+            int anio = almacen[manejador].anioNacimiento;
+            if (anio >= desde && anio <= hasta) {
+                pares.emplace_back(anio, manejador);
+            }
+        }
+    }
+    return ordenarPares(pares);
+}
+
+// Los k mejores promedios, recorriendo el índice desde el final
+std::vector<Manejador> ListadoEstudiantil::mejoresPromedios(int k) const {
+    std::vector<Manejador> resultado;
+    if (k <= 0) {
+        return resultado;
     }
     
-    archivo << "========================================\n";
-    archivo << "Total de estudiantes: " << tamanio << "\n";
-    archivo << "========================================\n";
+    if (indicesOrdenados) {
+        resultado.reserve(std::min(static_cast<size_t>(k), indices.arboles->promedio.size()));
+        for (auto it = indices.arboles->promedio.rbegin(); it != indices.arboles->promedio.rend() && k > 0; ++it, --k) {
+            resultado.push_back(it->second);
+        }
+        return resultado;
+    }
     
-    archivo.close();
+    // Sin índice: selección parcial O(n log k)
+    std::vector<std::pair<double, Manejador>> pares;
+    pares.reserve(tamanio);
+    for (const Manejador& manejador : orden) {
+        if (manejador.esValido()) {
+            pares.emplace_back(almacen[manejador].promedioAcademico, manejador);
+        }
+    }
+    size_t cantidad = std::min(static_cast<size_t>(k), pares.size());
+    std::partial_sort(pares.begin(), pares.begin() + cantidad, pares.end(),
+                      std::greater<std::pair<double, Manejador>>());
+    for (size_t i = 0; i < cantidad; i++) {
+        resultado.push_back(pares[i].second);
+    }
+    return resultado;
 }
 
-// Invertir la lista enlazada
-void ListadoEstudiantil::invertir() {
-    if (cabeza == nullptr || cabeza->siguiente == nullptr) {
-        return; // Lista vacía o con un solo elemento
+// Construir el índice de texto a partir de los registros actuales
+void ListadoEstudiantil::habilitarIndiceTexto() {
+    if (textoIndexado) {
+        return;
     }
+    indiceTexto.limpiar();
+    for (const Manejador& manejador : orden) {
+        if (manejador.esValido()) {
+            indiceTexto.agregar(manejador, almacen[manejador].nombreCompleto, almacen[manejador].email);
+        }
+    }
+    textoIndexado = true;
+}
+
+// Liberar el índice de texto (las búsquedas vuelven a recorrer la lista)
+void ListadoEstudiantil::deshabilitarIndiceTexto() {
+    indiceTexto.limpiar();
+    textoIndexado = false;
+}
+
+namespace {
+
+bool esSeparadorPalabra(char32_t c) {
+    return c == U' ' || c == U'.' || c == U'@' || c == U'-' || c == U'_';
+}
+
+// Verificar la coincidencia sobre el texto normalizado de un campo
+bool coincideTexto(const std::string& campo, const std::u32string& consulta, bool prefijo) {
+    std::u32string texto = IndiceTexto::normalizar(campo);
+    for (size_t i = texto.find(consulta); i != std::u32string::npos; i = texto.find(consulta, i + 1)) {
+        if (!prefijo || i == 0 || esSeparadorPalabra(texto[i - 1])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// Búsqueda por texto: candidatos del índice (o toda la lista) y verificación
+std::vector<Manejador> ListadoEstudiantil::buscarTexto(const std::string& consulta, CampoBusqueda campo,
+                                                       bool prefijo) const {
+    std::u32string normalizada = IndiceTexto::normalizar(consulta);
     
-    Nodo* anterior = nullptr;
-    Nodo* actual = cabeza;
-    Nodo* siguiente = nullptr;
-    
-    while (actual != nullptr) {
-        siguiente = actual->siguiente;
-        actual->siguiente = anterior;
-        anterior = actual;
-        actual = siguiente;
+    std::vector<Manejador> candidatos;
+    if (textoIndexado) {
+        candidatos = indiceTexto.candidatos(normalizada);
+        // El índice los devuelve en orden de alta; se ordenan según la lista
+        std::sort(candidatos.begin(), candidatos.end(), [this](const Manejador& a, const Manejador& b) {
+            return ordinalDeRanura[a.indice] < ordinalDeRanura[b.indice];
+        });
+    } else {
+        candidatos.reserve(tamanio);
+        for (const Manejador& manejador : orden) {
+            if (manejador.esValido()) {
+                candidatos.push_back(manejador);
+            }
+        }
     }
     
-    cabeza = anterior;
+    std::vector<Manejador> resultado;
+    for (const Manejador& manejador : candidatos) {
+        const Estudiante& registro = almacen[manejador];
+        if ((campo != CampoBusqueda::Email && coincideTexto(registro.nombreCompleto, normalizada, prefijo)) ||
+            (campo != CampoBusqueda::Nombre && coincideTexto(registro.email, normalizada, prefijo))) {
+            resultado.push_back(manejador);
+        }
+    }
+    return resultado;
 }
 
-// Sobrecarga del operador [] para acceso por índice
-Estudiante& ListadoEstudiantil::operator[](int indice) {
-    if (indice < 0 || indice >= tamanio) {
-        throw std::out_of_range("Índice fuera de rango");
+// Imprimir todos los elementos de la lista en un archivo de texto
+// El reporte se arma en búferes con to_chars (ver exportarRoster)
+void ListadoEstudiantil::imprimirEnArchivo(const std::string& nombreArchivo) const {
+    exportarRoster(*this, nombreArchivo, FormatoExportacion::Texto);
+}
+
+// Exportar en el formato pedido
+void ListadoEstudiantil::exportar(const std::string& nombreArchivo, FormatoExportacion formato,
+                                  int hilos) const {
+    exportarRoster(*this, nombreArchivo, formato, hilos);
+}
+
+// Invertir la lista
+void ListadoEstudiantil::invertir() {
+    if (tamanio < 2) {
+        return; // Lista vacía o con un solo elemento
     }
     
-    Nodo* actual = cabeza;
-    for (int i = 0; i < indice; i++) {
-        actual = actual->siguiente;
+    compactar();
+    std::reverse(orden.begin(), orden.end());
+    std::reverse(columnaAnio.begin(), columnaAnio.end());
+    std::reverse(columnaPromedio.begin(), columnaPromedio.end());
+    for (size_t i = 0; i < orden.size(); i++) {
+        ordinalDeRanura[orden[i].indice] = static_cast<uint32_t>(i);
     }
-    
-    return *(actual->estudiante);
 }
 
+// Sobrecarga del operador [] para acceso por índice (solo lectura)
+// Sin huecos O(1); con huecos O(log n) con el árbol de Fenwick, sin compactar:
+// la compactación queda a cargo de eliminar, con costo amortizado
 const Estudiante& ListadoEstudiantil::operator[](int indice) const {
     if (indice < 0 || indice >= tamanio) {
         throw std::out_of_range("Índice fuera de rango");
     }
     
-    Nodo* actual = cabeza;
-    for (int i = 0; i < indice; i++) {
-        actual = actual->siguiente;
-    }
-    
-    return *(actual->estudiante);
+    return almacen[orden[posicionFisica(indice)]];
 }
 
 // Imprimir en consola
@@ -170,19 +608,22 @@ void ListadoEstudiantil::imprimir() const {
     std::cout << "     LISTADO DE ESTUDIANTES\n";
     std::cout << "========================================\n\n";
     
-    Nodo* actual = cabeza;
     int contador = 1;
     
-    while (actual != nullptr) {
+    for (const Manejador& manejador : orden) {
+        if (!manejador.esValido()) {
+            continue;
+        }
+        const Estudiante* estudiante = &almacen[manejador];
+        
         std::cout << "Estudiante #" << contador << "\n";
         std::cout << "----------------------------------------\n";
-        std::cout << "Nombre: " << actual->estudiante->nombreCompleto << "\n";
-        std::cout << "Año de Nacimiento: " << actual->estudiante->anioNacimiento << "\n";
-        std::cout << "ID: " << actual->estudiante->numeroIdentificacion << "\n";
-        std::cout << "Promedio: " << actual->estudiante->promedioAcademico << "\n";
-        std::cout << "Email: " << actual->estudiante->email << "\n\n";
+        std::cout << "Nombre: " << estudiante->nombreCompleto << "\n";
+        std::cout << "Año de Nacimiento: " << estudiante->anioNacimiento << "\n";
+        std::cout << "ID: " << estudiante->numeroIdentificacion << "\n";
+        std::cout << "Promedio: " << estudiante->promedioAcademico << "\n";
+        std::cout << "Email: " << estudiante->email << "\n\n";
         
-        actual = actual->siguiente;
         contador++;
     }
     
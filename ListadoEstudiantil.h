@@ -3,6 +3,17 @@
 
 #include <string>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "AlmacenRanuras.h"
+#include "EstructurasLista.h"
+#include "IndiceTexto.h"
+#include "PoolNodos.h"
 
 // Estructura para almacenar información de estudiantes
 struct Estudiante {
@@ -19,52 +30,246 @@ struct Estudiante {
           numeroIdentificacion(id), promedioAcademico(promedio), email(correo) {}
 };
 
-// Clase ListadoEstudiantil - Lista enlazada simple
+// Formatos de exportación (ver ArchivoRoster.h)
+enum class FormatoExportacion {
+    Texto,   // Reporte legible, igual al de imprimirEnArchivo
+    CSV,     // Una línea por estudiante con cabecera (se lee con cargarDesdeCSV)
+    JSONL,   // Un objeto JSON por línea
+    Binario  // Roster binario (se lee con cargarDesdeBinario)
+};
+
+// Campos sobre los que busca buscarTexto
+enum class CampoBusqueda {
+    Nombre,
+    Email,
+    Ambos
+};
+
+// Clase ListadoEstudiantil - Lista ordenada sobre almacenamiento contiguo
+// Los registros viven en un vector generacional (AlmacenRanuras) con manejadores
+// estables; el orden de la lista es un vector de manejadores. Las eliminaciones
+// dejan un hueco en ese vector que se compacta de forma perezosa.
+// Notas:
+//  - El acceso a los registros es de solo lectura: para modificar uno se usa
+//    actualizar(), que mantiene al día el índice de IDs, los índices ordenados,
+//    las columnas y el índice de texto (nombreCompleto y email).
+//  - Las referencias devueltas por operator[] son válidas hasta la siguiente
+//    inserción; para referencias duraderas use obtenerManejador()/obtener().
 class ListadoEstudiantil {
 private:
-    // Nodo de la lista enlazada
-    struct Nodo {
-        Estudiante* estudiante;
-        Nodo* siguiente;
+    // Registros en memoria contigua
+    AlmacenRanuras<Estudiante> almacen;
+    
+    // Orden de la lista: manejadores, con huecos (inválidos) tras eliminar
+    std::vector<Manejador> orden;
+    
+    // Posición en 'orden' de cada ranura del almacén
+    std::vector<uint32_t> ordinalDeRanura;
+    
+    // Árbol de Fenwick sobre 'orden': 1 si la posición está ocupada.
+    // Solo se consulta mientras haya huecos pendientes de compactar.
+    ArbolFenwick fenwick;
+    int huecos;
+    int tamanio;
+    
+    // Índice hash de direccionamiento abierto: número de identificación -> manejador.
+    // La clave se compara contra el registro del almacén, así el ID no se duplica
+    // ni se asigna un nodo por entrada. Admite IDs repetidos.
+    TablaHashAbierta<Manejador> indiceIds; // Manejador::invalido() = entrada vacía
+    
+    // Índices ordenados secundarios (opcionales): pares (clave, manejador),
+    // mantenidos por insertar y eliminar solo si están habilitados.
+    // Los nodos de los árboles salen de un PoolNodos propio de la lista (o del
+    // recurso indicado al construirla). Una copia de la lista siempre recibe un
+    // pool propio, aunque la original use un recurso externo: así la copia no
+    // comparte con la original un pool sin sincronizar.
+    // El pool y los árboles van juntos en un bloque aparte que se crea al
+    // habilitar los índices: mover la lista pasa el bloque entero en O(1) sin
+    // asignar memoria, y la lista movida queda sin bloque.
+    struct IndicesSecundarios {
+        struct Arboles {
+            std::unique_ptr<PoolNodos> propio; // Nulo si el recurso es externo
+            std::pmr::set<std::pair<double, Manejador>> promedio;
+            std::pmr::set<std::pair<int, Manejador>> anio;
+            
+            explicit Arboles(std::pmr::memory_resource* externo);
+        };
+        std::pmr::memory_resource* externo; // Nulo: pool propio
+        std::unique_ptr<Arboles> arboles; // Nulo hasta habilitar (o tras mover)
+        
+        explicit IndicesSecundarios(std::pmr::memory_resource* externo);
+        IndicesSecundarios(const IndicesSecundarios& otro);
+        IndicesSecundarios(IndicesSecundarios&& otro) noexcept;
+        IndicesSecundarios& operator=(const IndicesSecundarios& otro);
+        IndicesSecundarios& operator=(IndicesSecundarios&& otro) noexcept;
         
-        Nodo(Estudiante* est) : estudiante(est), siguiente(nullptr) {}
+        // Crear el bloque si no existe
+        void crear();
+        
+        // Vaciar los árboles y devolver las páginas del pool propio
+        void limpiar();
     };
+    bool indicesOrdenados;
+    IndicesSecundarios indices;
     
-    Nodo* cabeza;
-    int tamanio;
+    // Columnas numéricas alineadas con 'orden' para las consultas vectorizadas
+    // (ver ConsultaEstudiantes). Un bit por fila indica si la fila está ocupada;
+    // las filas de los huecos conservan valores viejos con el bit en cero.
+    std::vector<int> columnaAnio;
+    std::vector<double> columnaPromedio;
+    std::vector<uint64_t> filasOcupadas;
+    
+    // Índice de trigramas sobre nombre y email (opcional, ver buscarTexto)
+    bool textoIndexado;
+    IndiceTexto indiceTexto;
+    
+    friend class ConsultaEstudiantes;
+    
+    // Quitar los huecos de 'orden' y reconstruir las posiciones en O(n)
+    void compactar();
+    
+    // Hash del número de identificación para el índice
+    static uint32_t hashId(const std::string& numeroIdentificacion);
+    
+    // Entrada del índice del registro con el ID dado que aparece primero en la
+    // lista, o -1 si no existe
+    long primeraAparicion(const std::string& numeroIdentificacion) const;
+    
+    // Posición en 'orden' del elemento con índice lógico 'indice'
+    int posicionFisica(int indice) const;
     
 public:
     // Constructor
     ListadoEstudiantil();
     
-    // Destructor
-    ~ListadoEstudiantil();
+    // Constructor con el recurso de memoria para los nodos de los índices ordenados
+    // (por ejemplo std::pmr::new_delete_resource() para usar el heap directamente,
+    // o un PoolNodos compartido por varias listas que debe vivir más que ellas).
+    // PoolNodos no es seguro entre hilos: las listas que lo comparten deben usarse
+    // desde un mismo hilo. Las copias de la lista no lo heredan.
+    explicit ListadoEstudiantil(std::pmr::memory_resource* recursoIndices);
+    
+    // Copiar duplica registros e índices; mover los pasa en O(1) y deja la
+    // lista de origen vacía
+    ListadoEstudiantil(const ListadoEstudiantil& otra) = default;
+    ListadoEstudiantil(ListadoEstudiantil&& otra) noexcept;
+    ListadoEstudiantil& operator=(const ListadoEstudiantil& otra) = default;
+    ListadoEstudiantil& operator=(ListadoEstudiantil&& otra) noexcept;
     
     // Método para insertar un nuevo nodo al final de la lista
     void insertar(const Estudiante& estudiante);
+    void insertar(Estudiante&& estudiante);
+    
+    // Método para insertar muchos estudiantes al final: reserva capacidad una vez
+    // y mueve los registros en lugar de copiarlos
+    void insertarLote(std::vector<Estudiante>&& estudiantes);
+    void insertarLote(const std::vector<Estudiante>& estudiantes);
+    template <typename Iterador>
+    void insertarLote(Iterador inicio, Iterador fin);
+    
+    // Método para reservar capacidad para 'cantidad' estudiantes en total
+    void reservar(int cantidad);
+    
+    // Métodos para cargar un roster al final de la lista (ver ArchivoRoster.h)
+    // Devuelven la cantidad de estudiantes cargados; lanzan std::runtime_error
+    int cargarDesdeCSV(const std::string& nombreArchivo, int hilos = 1);
+    int cargarDesdeBinario(const std::string& nombreArchivo);
     
     // Método para eliminar un nodo con un valor específico (por ID)
     bool eliminar(const std::string& numeroIdentificacion);
     
+    // Reemplazar los datos de un registro sin cambiar su posición en la lista.
+    // Cada índice se actualiza solo si cambió su clave (O(log n) con índices
+    // ordenados). Devuelven false si el registro no existe.
+    bool actualizar(Manejador manejador, const Estudiante& datos);
+    bool actualizar(const std::string& numeroIdentificacion, const Estudiante& datos);
+    
     // Método para buscar un valor en la lista y devolver su posición
     int buscar(const std::string& numeroIdentificacion) const;
     
     // Método para imprimir todos los elementos de la lista en archivo
     void imprimirEnArchivo(const std::string& nombreArchivo) const;
     
+    // Método para exportar la lista en otro formato; con hilos > 1 los tramos se
+    // formatean en paralelo y se escriben en orden. Lanza std::runtime_error.
+    void exportar(const std::string& nombreArchivo, FormatoExportacion formato, int hilos = 1) const;
+    
     // Método para invertir la lista enlazada
     void invertir();
     
-    // Sobrecarga del operador de acceso para permitir la indexación
-    Estudiante& operator[](int indice);
+    // Sobrecarga del operador de acceso para permitir la indexación (solo lectura).
+    // O(1) sin huecos; con huecos pendientes de compactar cuesta O(log n).
     const Estudiante& operator[](int indice) const;
     
+    // Manejadores estables: siguen siendo válidos ante inserciones y eliminaciones
+    // de otros registros (Manejador::invalido() si el ID no existe)
+    Manejador obtenerManejador(const std::string& numeroIdentificacion) const;
+    const Estudiante* obtener(Manejador manejador) const { return almacen.obtener(manejador); }
+    
+    // Índices ordenados por promedio y por año de nacimiento. Construirlos
+    // cuesta O(n log n); a partir de ahí cada inserción y eliminación suma O(log n).
+    void habilitarIndicesOrdenados();
+    void deshabilitarIndicesOrdenados();
+    bool tieneIndicesOrdenados() const { return indicesOrdenados; }
+    
+    // Consultas por rango (extremos incluidos), en orden ascendente de la clave.
+    // Con índices: O(log n + k); sin ellos se recorre y ordena la lista (O(n log n)).
+    std::vector<Manejador> rangoPromedio(double minimo, double maximo) const;
+    std::vector<Manejador> rangoAnio(int desde, int hasta) const;
+    std::vector<Manejador> nacidosEn(int anio) const { return rangoAnio(anio, anio); }
+    
+    // Los k mejores promedios en orden descendente. Con índices: O(k)
+    std::vector<Manejador> mejoresPromedios(int k) const;
+    
+    // Índice de texto sobre nombre y email. Construirlo cuesta O(largo total);
+    // cada inserción suma O(largo del registro) y cada eliminación O(1). Un
+    // cambio de nombre o email con actualizar() vuelve a indexar el registro.
+    void habilitarIndiceTexto();
+    void deshabilitarIndiceTexto();
+    bool tieneIndiceTexto() const { return textoIndexado; }
+    
+    // Búsqueda por subcadena sin distinguir mayúsculas ni tildes ("rodriguez"
+    // encuentra "Rodríguez"). Con prefijo = true la consulta debe coincidir con el
+    // comienzo de una palabra (inicio del campo o tras espacio, '.', '@', '-', '_').
+    // Resultados en el orden de la lista. Con índice solo se verifican los
+    // candidatos que contienen todos los trigramas de la consulta; sin él se
+    // recorre la lista completa.
+    std::vector<Manejador> buscarTexto(const std::string& consulta,
+                                       CampoBusqueda campo = CampoBusqueda::Ambos,
+                                       bool prefijo = false) const;
+    
     // Métodos auxiliares
     int obtenerTamanio() const { return tamanio; }
-    bool estaVacia() const { return cabeza == nullptr; }
+    bool estaVacia() const { return tamanio == 0; }
     
     // Método para imprimir en consola
     void imprimir() const;
+    
+    // Recorrer los estudiantes en el orden de la lista sin índices lógicos
+    template <typename Funcion>
+    void recorrer(Funcion funcion) const;
 };
 
+// Insertar un rango de estudiantes; con std::make_move_iterator se mueven
+template <typename Iterador>
+void ListadoEstudiantil::insertarLote(Iterador inicio, Iterador fin) {
+    using Categoria = typename std::iterator_traits<Iterador>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Categoria>::value) {
+        reservar(tamanio + static_cast<int>(std::distance(inicio, fin)));
+    }
+    for (; inicio != fin; ++inicio) {
+        insertar(*inicio);
+    }
+}
+
+// Recorrer 'orden' saltando los huecos: O(n) sin pasar por operator[]
+template <typename Funcion>
+void ListadoEstudiantil::recorrer(Funcion funcion) const {
+    for (const Manejador& manejador : orden) {
+        if (manejador.esValido()) {
+            funcion(almacen[manejador]);
+        }
+    }
+}
+
 #endif // LISTADO_ESTUDIANTIL_H
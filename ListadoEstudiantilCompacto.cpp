@@ -0,0 +1,211 @@
+#include "ListadoEstudiantilCompacto.h"
+#include <functional>
+#include <stdexcept>
+
+namespace {
+
+// Hash de 32 bits del número de identificación
+uint32_t hashTexto(std::string_view texto) {
+    uint64_t h = std::hash<std::string_view>()(texto);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<uint32_t>(h);
+}
+
+const uint32_t POSICION_VACIA = UINT32_MAX;
+
+} // namespace
+
+// ========== VISTA ==========
+
+std::string EstudianteVista::email() const {
+    std::string completo;
+    completo.reserve(usuarioEmail.size() + dominioEmail.size());
+    completo.append(usuarioEmail);
+    completo.append(dominioEmail);
+    return completo;
+}
+
+Estudiante EstudianteVista::aEstudiante() const {
+    return Estudiante(std::string(nombreCompleto), anioNacimiento, std::string(numeroIdentificacion),
+                      promedioAcademico, email());
+}
+
+// ========== LISTA COMPACTA ==========
+
+// Constructor - lista vacía con el dominio vacío ya internado
+ListadoEstudiantilCompacto::ListadoEstudiantilCompacto()
+    : huecos(0), dominios{std::string_view()}, indiceIds(POSICION_VACIA), bytesMuertos(0) {
+    indiceDominios.emplace(std::string_view(), 0);
+}
+
+// Devolver el número del dominio, guardándolo en la arena la primera vez
+uint32_t ListadoEstudiantilCompacto::internarDominio(std::string_view dominio) {
+    auto existente = indiceDominios.find(dominio);
+    if (existente != indiceDominios.end()) {
+        return existente->second;
+    }
+    std::string_view guardado = arena.guardar(dominio);
+    uint32_t numero = static_cast<uint32_t>(dominios.size());
+    dominios.push_back(guardado);
+    indiceDominios.emplace(guardado, numero);
+    return numero;
+}
+
+// Entrada del índice con el ID dado y menor posición, o -1
+long ListadoEstudiantilCompacto::primeraAparicion(std::string_view numeroIdentificacion) const {
+    long primera = -1;
+    indiceIds.recorrerGrupo(hashTexto(numeroIdentificacion), [&](size_t entrada, uint32_t posicion) {
+        if (registros[posicion].id == numeroIdentificacion &&
+            (primera == -1 || posicion < indiceIds[primera])) {
+            primera = static_cast<long>(entrada);
+        }
+    });
+    return primera;
+}
+
+// Quitar los huecos; el índice guarda posiciones físicas, así que se corrigen
+// todas con la nueva posición de cada registro
+void ListadoEstudiantilCompacto::compactar() {
+    std::vector<uint32_t> nuevaPosicion(registros.size(), POSICION_VACIA);
+    size_t destino = 0;
+    for (size_t i = 0; i < registros.size(); i++) {
+        if (registros[i].dominio != HUECO) {
+            nuevaPosicion[i] = static_cast<uint32_t>(destino);
+            registros[destino++] = registros[i];
+        }
+    }
+    registros.resize(destino);
+    indiceIds.reasignar([&](uint32_t posicion) { return nuevaPosicion[posicion]; });
+    fenwick.llenar(static_cast<int>(destino));
+    huecos = 0;
+}
+
+// Insertar al final; el email se separa en usuario y dominio internado
+void ListadoEstudiantilCompacto::insertar(const Estudiante& estudiante) {
+    std::string_view email = estudiante.email;
+    size_t arroba = email.rfind('@');
+    std::string_view usuario = arroba == std::string_view::npos ? email : email.substr(0, arroba);
+    std::string_view dominio = arroba == std::string_view::npos ? std::string_view() : email.substr(arroba);
+
+    Registro registro;
+    registro.nombre = arena.guardar(estudiante.nombreCompleto);
+    registro.id = arena.guardar(estudiante.numeroIdentificacion);
+    registro.usuarioEmail = arena.guardar(usuario);
+    registro.dominio = internarDominio(dominio);
+    registro.anio = estudiante.anioNacimiento;
+    registro.promedio = estudiante.promedioAcademico;
+
+    uint32_t posicion = static_cast<uint32_t>(registros.size());
+    registros.push_back(registro);
+    indiceIds.insertar(hashTexto(registro.id), posicion);
+    fenwick.extender(huecos == 0);
+}
+
+void ListadoEstudiantilCompacto::insertarLote(const std::vector<Estudiante>& estudiantes) {
+    reservar(obtenerTamanio() + static_cast<int>(estudiantes.size()));
+    for (const Estudiante& estudiante : estudiantes) {
+        insertar(estudiante);
+    }
+}
+
+void ListadoEstudiantilCompacto::reservar(int cantidad) {
+    if (cantidad <= 0) {
+        return;
+    }
+    size_t n = static_cast<size_t>(cantidad);
+    registros.reserve(n + static_cast<size_t>(huecos));
+    fenwick.reservar(n + static_cast<size_t>(huecos));
+    indiceIds.reservar(n);
+}
+
+// Eliminar la primera aparición; su posición queda como hueco
+bool ListadoEstudiantilCompacto::eliminar(const std::string& numeroIdentificacion) {
+    long entrada = primeraAparicion(numeroIdentificacion);
+    if (entrada == -1) {
+        return false;
+    }
+
+    uint32_t posicion = indiceIds[entrada];
+    indiceIds.quitar(static_cast<size_t>(entrada));
+
+    Registro& registro = registros[posicion];
+    bytesMuertos += registro.nombre.size() + registro.id.size() + registro.usuarioEmail.size();
+    registro = Registro{std::string_view(), std::string_view(), std::string_view(), HUECO, 0, 0.0};
+    fenwick.agregar(static_cast<int>(posicion), -1);
+    huecos++;
+
+    // Los huecos al final se descartan de inmediato
+    while (!registros.empty() && registros.back().dominio == HUECO) {
+        registros.pop_back();
+        fenwick.recortar();
+        huecos--;
+    }
+
+    // Acotar la memoria ocupada por huecos (O(1) amortizado)
+    if (huecos > obtenerTamanio() + 64) {
+        compactar();
+    }
+
+    // Cuando más de la mitad de la arena es texto muerto se copia lo vivo
+    if (bytesMuertos > 1 << 16 && bytesMuertos * 2 > arena.obtenerBytesUsados()) {
+        compactarTexto();
+    }
+    return true;
+}
+
+// Copiar el texto vivo (y los dominios) a una arena nueva; la vieja se libera
+// por bloques completos al salir
+void ListadoEstudiantilCompacto::compactarTexto() {
+    ArenaTexto nueva;
+
+    indiceDominios.clear();
+    for (std::string_view& dominio : dominios) {
+        dominio = nueva.guardar(dominio);
+    }
+    for (uint32_t i = 0; i < dominios.size(); i++) {
+        indiceDominios.emplace(dominios[i], i);
+    }
+
+    for (Registro& registro : registros) {
+        if (registro.dominio == HUECO) {
+            continue;
+        }
+        registro.nombre = nueva.guardar(registro.nombre);
+        registro.id = nueva.guardar(registro.id);
+        registro.usuarioEmail = nueva.guardar(registro.usuarioEmail);
+    }
+
+    arena = std::move(nueva);
+    bytesMuertos = 0;
+}
+
+int ListadoEstudiantilCompacto::buscar(const std::string& numeroIdentificacion) const {
+    long entrada = primeraAparicion(numeroIdentificacion);
+    if (entrada == -1) {
+        return -1;
+    }
+    int posicion = static_cast<int>(indiceIds[entrada]);
+    return huecos == 0 ? posicion : fenwick.prefijo(posicion);
+}
+
+EstudianteVista ListadoEstudiantilCompacto::vista(const Registro& registro) const {
+    return EstudianteVista{registro.nombre, registro.anio, registro.id, registro.promedio,
+                           registro.usuarioEmail, dominios[registro.dominio]};
+}
+
+EstudianteVista ListadoEstudiantilCompacto::operator[](int indice) const {
+    if (indice < 0 || indice >= obtenerTamanio()) {
+        throw std::out_of_range("Índice fuera de rango");
+    }
+    return vista(registros[huecos == 0 ? indice : fenwick.seleccionar(indice)]);
+}
+
+size_t ListadoEstudiantilCompacto::obtenerMemoriaAproximada() const {
+    return registros.capacity() * sizeof(Registro) + fenwick.obtenerBytesReservados() +
+           indiceIds.obtenerBytesReservados() +
+           dominios.capacity() * sizeof(std::string_view) +
+           indiceDominios.size() * (sizeof(std::string_view) + sizeof(uint32_t) + 2 * sizeof(void*)) +
+           arena.obtenerBytesReservados();
+}
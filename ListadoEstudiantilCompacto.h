@@ -0,0 +1,120 @@
+#ifndef LISTADO_ESTUDIANTIL_COMPACTO_H
+#define LISTADO_ESTUDIANTIL_COMPACTO_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "ArenaTexto.h"
+#include "EstructurasLista.h"
+#include "ListadoEstudiantil.h"
+
+// Vista de solo lectura de un estudiante guardado en forma compacta.
+// Las vistas apuntan a la arena de la lista y valen hasta la siguiente eliminación.
+struct EstudianteVista {
+    std::string_view nombreCompleto;
+    int anioNacimiento;
+    std::string_view numeroIdentificacion;
+    double promedioAcademico;
+    std::string_view usuarioEmail; // Parte anterior al último '@'
+    std::string_view dominioEmail; // "@dominio" internado, vacío si no hay '@'
+
+    // Email completo (usuario + dominio)
+    std::string email() const;
+
+    // Copia independiente como Estudiante
+    Estudiante aEstudiante() const;
+};
+
+// Clase ListadoEstudiantilCompacto - Lista de estudiantes con el texto en una arena
+// Cada registro ocupa 64 bytes fijos con vistas a bloques de texto de 64 KB, en
+// lugar de tres std::string con su propia asignación. Los dominios de email se
+// guardan una sola vez y cada registro solo conserva su número.
+// Pensada para rosters grandes de lectura: insertar, buscar y eliminar son O(1)
+// esperado (amortizado). Como en ListadoEstudiantil, eliminar deja un hueco en
+// el vector de registros y un árbol de Fenwick traduce índices lógicos mientras
+// haya huecos; se compacta cuando los huecos superan a los registros vivos.
+// No se puede copiar.
+class ListadoEstudiantilCompacto {
+private:
+    struct Registro {
+        std::string_view nombre;
+        std::string_view id;
+        std::string_view usuarioEmail;
+        uint32_t dominio;
+        int32_t anio;
+        double promedio;
+    };
+
+    ArenaTexto arena;
+    std::vector<Registro> registros; // Con huecos (dominio == HUECO) tras eliminar
+    static constexpr uint32_t HUECO = UINT32_MAX;
+
+    // Árbol de Fenwick sobre 'registros': 1 si la posición está ocupada.
+    // Solo se consulta mientras haya huecos pendientes de compactar.
+    ArbolFenwick fenwick;
+    int huecos;
+
+    // Dominios internados; el 0 es el dominio vacío
+    std::vector<std::string_view> dominios;
+    std::unordered_map<std::string_view, uint32_t> indiceDominios;
+
+    // Índice hash de direccionamiento abierto: ID -> posición física (admite repetidos)
+    TablaHashAbierta<uint32_t> indiceIds; // UINT32_MAX = entrada vacía
+
+    // Bytes de la arena que pertenecen a registros eliminados
+    size_t bytesMuertos;
+
+    uint32_t internarDominio(std::string_view dominio);
+    long primeraAparicion(std::string_view numeroIdentificacion) const;
+
+    // Quitar los huecos de 'registros' y corregir las posiciones del índice en O(n)
+    void compactar();
+
+    // Copiar el texto vivo a una arena nueva y soltar los bloques viejos
+    void compactarTexto();
+
+    EstudianteVista vista(const Registro& registro) const;
+
+public:
+    ListadoEstudiantilCompacto();
+
+    ListadoEstudiantilCompacto(const ListadoEstudiantilCompacto&) = delete;
+    ListadoEstudiantilCompacto& operator=(const ListadoEstudiantilCompacto&) = delete;
+
+    // Insertar al final copiando el texto a la arena (O(1) amortizado)
+    void insertar(const Estudiante& estudiante);
+    void insertarLote(const std::vector<Estudiante>& estudiantes);
+    void reservar(int cantidad);
+
+    // Eliminar la primera aparición del ID (O(1) esperado, amortizado)
+    bool eliminar(const std::string& numeroIdentificacion);
+
+    // Posición de la primera aparición del ID o -1 (O(1) esperado; O(log n) con huecos)
+    int buscar(const std::string& numeroIdentificacion) const;
+
+    // Acceso por índice (O(1); O(log n) con huecos); lanza std::out_of_range
+    EstudianteVista operator[](int indice) const;
+
+    // Recorrer los estudiantes en orden
+    template <typename Funcion>
+    void recorrer(Funcion funcion) const {
+        for (const Registro& registro : registros) {
+            if (registro.dominio != HUECO) {
+                funcion(vista(registro));
+            }
+        }
+    }
+
+    // Métodos auxiliares
+    int obtenerTamanio() const { return static_cast<int>(registros.size()) - huecos; }
+    bool estaVacia() const { return obtenerTamanio() == 0; }
+    size_t obtenerCantidadDominios() const { return dominios.size() - 1; }
+    size_t obtenerBytesTexto() const { return arena.obtenerBytesUsados(); }
+
+    // Memoria aproximada en uso (registros, arena, índices), en bytes
+    size_t obtenerMemoriaAproximada() const;
+};
+
+#endif // LISTADO_ESTUDIANTIL_COMPACTO_H
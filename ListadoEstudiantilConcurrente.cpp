@@ -0,0 +1,57 @@
+#include "ListadoEstudiantilConcurrente.h"
+#include <utility>
+
+// ========== LECTOR ==========
+
+ListadoEstudiantilConcurrente::Lector::Lector(const ListadoEstudiantilConcurrente& origen)
+    : origen(origen), versionCache(origen.obtenerVersion()) {
+    cache = origen.obtenerInstantanea();
+}
+
+// La versión se lee antes que la instantánea: el escritor publica la lista y
+// luego aumenta la versión, así que la instantánea leída nunca es más vieja
+// que la versión guardada (a lo sumo más nueva, y se relee sin perjuicio).
+const ListadoEstudiantil& ListadoEstudiantilConcurrente::Lector::actual() {
+    uint64_t vigente = origen.obtenerVersion();
+    if (vigente != versionCache) {
+        cache = origen.obtenerInstantanea();
+        versionCache = vigente;
+    }
+    return *cache;
+}
+
+// ========== LISTA CONCURRENTE ==========
+
+ListadoEstudiantilConcurrente::ListadoEstudiantilConcurrente()
+    : instantanea(std::make_shared<const ListadoEstudiantil>()), version(0) {}
+
+ListadoEstudiantilConcurrente::ListadoEstudiantilConcurrente(ListadoEstudiantil inicial)
+    : instantanea(std::make_shared<const ListadoEstudiantil>(std::move(inicial))), version(0) {}
+
+std::shared_ptr<const ListadoEstudiantil> ListadoEstudiantilConcurrente::obtenerInstantanea() const {
+    return std::atomic_load(&instantanea);
+}
+
+// Publicar la nueva lista y luego la versión (el mutex de escritura ya está tomado).
+// La instantánea anterior se libera cuando el último lector la suelta.
+void ListadoEstudiantilConcurrente::publicar(std::shared_ptr<const ListadoEstudiantil> nueva) {
+    std::atomic_store(&instantanea, std::move(nueva));
+    version.fetch_add(1, std::memory_order_release);
+}
+
+void ListadoEstudiantilConcurrente::insertar(const Estudiante& estudiante) {
+    modificar([&estudiante](ListadoEstudiantil& lista) { lista.insertar(estudiante); });
+}
+
+// Si el ID no existe no se publica nada
+bool ListadoEstudiantilConcurrente::eliminar(const std::string& numeroIdentificacion) {
+    std::lock_guard<std::mutex> bloqueo(mutexEscritura);
+    std::shared_ptr<const ListadoEstudiantil> vigente = std::atomic_load(&instantanea);
+    if (vigente->buscar(numeroIdentificacion) == -1) {
+        return false;
+    }
+    auto copia = std::make_shared<ListadoEstudiantil>(*vigente);
+    copia->eliminar(numeroIdentificacion);
+    publicar(std::move(copia));
+    return true;
+}
@@ -0,0 +1,83 @@
+#ifndef LISTADO_ESTUDIANTIL_CONCURRENTE_H
+#define LISTADO_ESTUDIANTIL_CONCURRENTE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "ListadoEstudiantil.h"
+
+// Clase ListadoEstudiantilConcurrente - Lista compartida entre hilos con instantáneas
+// Los lectores ven siempre una ListadoEstudiantil inmutable (instantánea). Los
+// escritores se serializan con un mutex, copian la instantánea actual, aplican
+// los cambios y publican la copia (copy-on-write). Cada escritura cuesta O(n);
+// para varios cambios seguidos conviene agruparlos con modificar().
+//
+// Los lectores usan un Lector por hilo: guarda su instantánea y solo la renueva
+// cuando cambia el número de versión, así que leer no escribe memoria compartida
+// y las lecturas escalan con la cantidad de hilos.
+class ListadoEstudiantilConcurrente {
+private:
+    std::mutex mutexEscritura;
+    std::shared_ptr<const ListadoEstudiantil> instantanea; // Acceso con std::atomic_load/store
+    std::atomic<uint64_t> version;
+
+    void publicar(std::shared_ptr<const ListadoEstudiantil> nueva);
+
+public:
+    // Lector de un solo hilo. Las referencias que devuelve valen hasta la
+    // siguiente llamada al mismo Lector (que puede cambiar de instantánea).
+    class Lector {
+    private:
+        const ListadoEstudiantilConcurrente& origen;
+        std::shared_ptr<const ListadoEstudiantil> cache;
+        uint64_t versionCache;
+
+    public:
+        explicit Lector(const ListadoEstudiantilConcurrente& origen);
+
+        // Instantánea vigente (se renueva solo si hubo escrituras)
+        const ListadoEstudiantil& actual();
+
+        int buscar(const std::string& numeroIdentificacion) { return actual().buscar(numeroIdentificacion); }
+        const Estudiante& operator[](int indice) { return actual()[indice]; }
+        int obtenerTamanio() { return actual().obtenerTamanio(); }
+
+        template <typename Funcion>
+        void recorrer(Funcion funcion) { actual().recorrer(funcion); }
+    };
+
+    ListadoEstudiantilConcurrente();
+
+    // Empezar desde una lista existente (se toma por valor)
+    explicit ListadoEstudiantilConcurrente(ListadoEstudiantil inicial);
+
+    ListadoEstudiantilConcurrente(const ListadoEstudiantilConcurrente&) = delete;
+    ListadoEstudiantilConcurrente& operator=(const ListadoEstudiantilConcurrente&) = delete;
+
+    // Instantánea actual; sigue siendo válida aunque luego haya escrituras
+    std::shared_ptr<const ListadoEstudiantil> obtenerInstantanea() const;
+
+    // Número de versión: aumenta en uno con cada publicación
+    uint64_t obtenerVersion() const { return version.load(std::memory_order_acquire); }
+
+    // Escrituras individuales (cada una copia la lista)
+    void insertar(const Estudiante& estudiante);
+    bool eliminar(const std::string& numeroIdentificacion);
+
+    // Aplicar varios cambios con una sola copia y una sola publicación.
+    // 'cambios' recibe ListadoEstudiantil& y no debe usar esta misma lista.
+    template <typename Funcion>
+    void modificar(Funcion cambios);
+};
+
+template <typename Funcion>
+void ListadoEstudiantilConcurrente::modificar(Funcion cambios) {
+    std::lock_guard<std::mutex> bloqueo(mutexEscritura);
+    auto copia = std::make_shared<ListadoEstudiantil>(*std::atomic_load(&instantanea));
+    cambios(*copia);
+    publicar(std::move(copia));
+}
+
+#endif // LISTADO_ESTUDIANTIL_CONCURRENTE_H
@@ -0,0 +1,204 @@
+#include "ListadoEstudiantilFragmentado.h"
+#include "ArchivoRoster.h"
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+namespace {
+
+// Ejecutar funcion(t) para t en [0, hilos): el hilo llamador hace t = 0.
+// Si alguno lanza, se relanza la excepción del menor t después de esperar a todos.
+template <typename Funcion>
+void ejecutarEnHilos(int hilos, Funcion funcion) {
+    std::vector<std::exception_ptr> errores(hilos);
+    std::vector<std::thread> trabajadores;
+    for (int t = 1; t < hilos; t++) {
+        trabajadores.emplace_back([&, t]() {
+            try {
+                funcion(t);
+            } catch (...) {
+                errores[t] = std::current_exception();
+            }
+        });
+    }
+    try {
+        funcion(0);
+    } catch (...) {
+        errores[0] = std::current_exception();
+    }
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+    for (const std::exception_ptr& error : errores) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+bool terminaEn(const std::string& texto, const std::string& sufijo) {
+    return texto.size() >= sufijo.size() &&
+           texto.compare(texto.size() - sufijo.size(), sufijo.size(), sufijo) == 0;
+}
+
+} // namespace
+
+// Constructor - fragmentos vacíos
+ListadoEstudiantilFragmentado::ListadoEstudiantilFragmentado(int cantidadFragmentos)
+    : cantidadFragmentos(std::max(1, cantidadFragmentos)),
+      fragmentos(new Fragmento[std::max(1, cantidadFragmentos)]),
+      tamanio(0) {}
+
+// Se usan los 32 bits altos de una mezcla distinta de la del índice interno de
+// cada lista, para que los IDs de un mismo fragmento no se agrupen en su tabla
+int ListadoEstudiantilFragmentado::fragmentoDe(const std::string& numeroIdentificacion) const {
+    uint64_t h = std::hash<std::string>()(numeroIdentificacion);
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 29;
+    return static_cast<int>(((h >> 32) * static_cast<uint64_t>(cantidadFragmentos)) >> 32);
+}
+
+bool ListadoEstudiantilFragmentado::insertar(const Estudiante& estudiante) {
+    Fragmento& fragmento = fragmentos[fragmentoDe(estudiante.numeroIdentificacion)];
+    std::lock_guard<std::mutex> bloqueo(fragmento.mutex);
+    if (fragmento.lista.obtenerManejador(estudiante.numeroIdentificacion).esValido()) {
+        return false;
+    }
+    fragmento.lista.insertar(estudiante);
+    tamanio++;
+    return true;
+}
+
+bool ListadoEstudiantilFragmentado::eliminar(const std::string& numeroIdentificacion) {
+    Fragmento& fragmento = fragmentos[fragmentoDe(numeroIdentificacion)];
+    std::lock_guard<std::mutex> bloqueo(fragmento.mutex);
+    if (!fragmento.lista.eliminar(numeroIdentificacion)) {
+        return false;
+    }
+    tamanio--;
+    return true;
+}
+
+std::optional<Estudiante> ListadoEstudiantilFragmentado::buscar(const std::string& numeroIdentificacion) const {
+    const Fragmento& fragmento = fragmentos[fragmentoDe(numeroIdentificacion)];
+    std::lock_guard<std::mutex> bloqueo(fragmento.mutex);
+    const Estudiante* estudiante = fragmento.lista.obtener(fragmento.lista.obtenerManejador(numeroIdentificacion));
+    if (estudiante == nullptr) {
+        return std::nullopt;
+    }
+    return *estudiante;
+}
+
+bool ListadoEstudiantilFragmentado::contiene(const std::string& numeroIdentificacion) const {
+    const Fragmento& fragmento = fragmentos[fragmentoDe(numeroIdentificacion)];
+    std::lock_guard<std::mutex> bloqueo(fragmento.mutex);
+    return fragmento.lista.obtenerManejador(numeroIdentificacion).esValido();
+}
+
+// Fase 1: cada hilo reparte su tramo en cubetas[hilo][fragmento] (posiciones de
+// la entrada). Fase 2: cada hilo llena sus fragmentos recorriendo las cubetas de
+// todos los tramos en orden, con el mutex del fragmento tomado.
+ResultadoIngesta ListadoEstudiantilFragmentado::ingerirLote(std::vector<Estudiante>&& estudiantes, int hilos) {
+    size_t total = estudiantes.size();
+    hilos = std::max(1, std::min(hilos, cantidadFragmentos));
+    if (total < static_cast<size_t>(hilos) * 1024) {
+        hilos = 1; // No vale la pena crear hilos para lotes chicos
+    }
+
+    std::vector<std::vector<std::vector<size_t>>> cubetas(
+        hilos, std::vector<std::vector<size_t>>(cantidadFragmentos));
+    ejecutarEnHilos(hilos, [&](int t) {
+        size_t desde = total * t / hilos;
+        size_t hasta = total * (t + 1) / hilos;
+        for (size_t i = desde; i < hasta; i++) {
+            cubetas[t][fragmentoDe(estudiantes[i].numeroIdentificacion)].push_back(i);
+        }
+    });
+
+    // Repetidos de cada hilo como (posición en la entrada, ID)
+    std::vector<std::vector<std::pair<size_t, std::string>>> repetidos(hilos);
+    std::vector<int> insertados(hilos, 0);
+    ejecutarEnHilos(hilos, [&](int t) {
+        for (int f = t; f < cantidadFragmentos; f += hilos) {
+            size_t cantidad = 0;
+            for (int origen = 0; origen < hilos; origen++) {
+                cantidad += cubetas[origen][f].size();
+            }
+            Fragmento& fragmento = fragmentos[f];
+            std::lock_guard<std::mutex> bloqueo(fragmento.mutex);
+            fragmento.lista.reservar(fragmento.lista.obtenerTamanio() + static_cast<int>(cantidad));
+            for (int origen = 0; origen < hilos; origen++) {
+                for (size_t i : cubetas[origen][f]) {
+                    Estudiante& estudiante = estudiantes[i];
+                    if (fragmento.lista.obtenerManejador(estudiante.numeroIdentificacion).esValido()) {
+                        repetidos[t].emplace_back(i, std::move(estudiante.numeroIdentificacion));
+                    } else {
+                        fragmento.lista.insertar(std::move(estudiante));
+                        insertados[t]++;
+                    }
+                }
+            }
+        }
+    });
+
+    ResultadoIngesta resultado;
+    std::vector<std::pair<size_t, std::string>> todos;
+    for (int t = 0; t < hilos; t++) {
+        resultado.insertados += insertados[t];
+        std::move(repetidos[t].begin(), repetidos[t].end(), std::back_inserter(todos));
+    }
+    std::sort(todos.begin(), todos.end());
+    resultado.duplicados.reserve(todos.size());
+    for (auto& par : todos) {
+        resultado.duplicados.push_back(std::move(par.second));
+    }
+
+    tamanio += resultado.insertados;
+    estudiantes.clear();
+    return resultado;
+}
+
+// Cada hilo toma el siguiente archivo pendiente; los registros se ingieren
+// después, todos juntos, en el orden de la lista de archivos
+ResultadoIngesta ListadoEstudiantilFragmentado::ingerirArchivos(const std::vector<std::string>& archivos, int hilos) {
+    std::vector<std::vector<Estudiante>> porArchivo(archivos.size());
+    std::atomic<size_t> siguiente(0);
+    int hilosLectura = std::max(1, std::min(hilos, static_cast<int>(archivos.size())));
+    ejecutarEnHilos(hilosLectura, [&](int) {
+        for (size_t i = siguiente++; i < archivos.size(); i = siguiente++) {
+            porArchivo[i] = terminaEn(archivos[i], ".csv") ? leerRosterCSV(archivos[i])
+                                                           : leerRosterBinario(archivos[i]);
+        }
+    });
+
+    size_t total = 0;
+    for (const std::vector<Estudiante>& registros : porArchivo) {
+        total += registros.size();
+    }
+    std::vector<Estudiante> todos;
+    todos.reserve(total);
+    for (std::vector<Estudiante>& registros : porArchivo) {
+        std::move(registros.begin(), registros.end(), std::back_inserter(todos));
+        registros = std::vector<Estudiante>();
+    }
+    return ingerirLote(std::move(todos), hilos);
+}
+
+ListadoEstudiantil ListadoEstudiantilFragmentado::fusionar() const {
+    ListadoEstudiantil resultado;
+    resultado.reservar(obtenerTamanio());
+    recorrer([&resultado](const Estudiante& estudiante) { resultado.insertar(estudiante); });
+    return resultado;
+}
+
+int ListadoEstudiantilFragmentado::obtenerTamanioFragmento(int fragmento) const {
+    if (fragmento < 0 || fragmento >= cantidadFragmentos) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> bloqueo(fragmentos[fragmento].mutex);
+    return fragmentos[fragmento].lista.obtenerTamanio();
+}
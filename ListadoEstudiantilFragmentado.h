@@ -0,0 +1,93 @@
+#ifndef LISTADO_ESTUDIANTIL_FRAGMENTADO_H
+#define LISTADO_ESTUDIANTIL_FRAGMENTADO_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#include "ListadoEstudiantil.h"
+
+// Resultado de una ingesta: registros aceptados e IDs rechazados por repetidos,
+// en el orden de la entrada
+struct ResultadoIngesta {
+    int insertados = 0;
+    std::vector<std::string> duplicados;
+};
+
+// Clase ListadoEstudiantilFragmentado - Roster repartido en N fragmentos por hash del ID
+// Cada fragmento es una ListadoEstudiantil con su propio mutex. Como el fragmento
+// depende solo del número de identificación, todas las apariciones de un ID caen
+// en el mismo fragmento y los repetidos se detectan sin bloqueo global: en este
+// roster los IDs son únicos y un repetido se rechaza.
+//
+// La ingesta por lote tiene dos fases: cada hilo reparte un tramo de la entrada
+// en cubetas por fragmento, y luego cada hilo llena sus fragmentos (fragmento i
+// para el hilo i % hilos) con las cubetas de todos los tramos en orden. Así cada
+// fragmento recibe los registros en el orden de la entrada y, entre repetidos,
+// siempre queda el primero.
+//
+// Las operaciones individuales (insertar, eliminar, buscar) son seguras entre
+// hilos y solo bloquean el fragmento del ID.
+class ListadoEstudiantilFragmentado {
+private:
+    // Alineado a línea de caché para que los mutex vecinos no compartan línea
+    struct alignas(64) Fragmento {
+        mutable std::mutex mutex;
+        ListadoEstudiantil lista;
+    };
+
+    int cantidadFragmentos;
+    std::unique_ptr<Fragmento[]> fragmentos;
+    std::atomic<int> tamanio;
+
+public:
+    // Constructor con la cantidad de fragmentos (al menos 1)
+    explicit ListadoEstudiantilFragmentado(int cantidadFragmentos = 16);
+
+    ListadoEstudiantilFragmentado(const ListadoEstudiantilFragmentado&) = delete;
+    ListadoEstudiantilFragmentado& operator=(const ListadoEstudiantilFragmentado&) = delete;
+
+    // Fragmento que corresponde a un número de identificación
+    int fragmentoDe(const std::string& numeroIdentificacion) const;
+
+    // Insertar si el ID no existe; devuelve false si es repetido
+    bool insertar(const Estudiante& estudiante);
+    bool eliminar(const std::string& numeroIdentificacion);
+
+    // Copia del registro con el ID dado (vacío si no existe)
+    std::optional<Estudiante> buscar(const std::string& numeroIdentificacion) const;
+    bool contiene(const std::string& numeroIdentificacion) const;
+
+    // Ingerir un lote con 'hilos' hilos (mueve los registros y vacía el vector)
+    ResultadoIngesta ingerirLote(std::vector<Estudiante>&& estudiantes, int hilos = 1);
+
+    // Leer varios rosters en paralelo (".csv" como CSV, el resto como roster
+    // binario) e ingerirlos en el orden de la lista de archivos. Si un archivo
+    // falla se lanza std::runtime_error y no se inserta nada.
+    ResultadoIngesta ingerirArchivos(const std::vector<std::string>& archivos, int hilos = 1);
+
+    // Una sola lista con todos los registros, fragmento por fragmento
+    // (dentro de cada fragmento en orden de inserción)
+    ListadoEstudiantil fusionar() const;
+
+    // Recorrer todos los registros, fragmento por fragmento (bloquea uno a la vez)
+    template <typename Funcion>
+    void recorrer(Funcion funcion) const;
+
+    int obtenerTamanio() const { return tamanio.load(); }
+    bool estaVacia() const { return obtenerTamanio() == 0; }
+    int obtenerCantidadFragmentos() const { return cantidadFragmentos; }
+    int obtenerTamanioFragmento(int fragmento) const;
+};
+
+template <typename Funcion>
+void ListadoEstudiantilFragmentado::recorrer(Funcion funcion) const {
+    for (int i = 0; i < cantidadFragmentos; i++) {
+        std::lock_guard<std::mutex> bloqueo(fragmentos[i].mutex);
+        fragmentos[i].lista.recorrer(funcion);
+    }
+}
+
+#endif // LISTADO_ESTUDIANTIL_FRAGMENTADO_H
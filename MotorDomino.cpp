@@ -0,0 +1,369 @@
+/**
+ * @file MotorDomino.cpp
+ * @brief Implementación del motor de dominó sin consola.
+ */
+
+#include "MotorDomino.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// PUNTOS_POR_BLOQUE[b][m]: puntos de las fichas 7b..7b+6 presentes en los 7 bits de m
+struct TablaPuntos {
+  int16_t puntos[4][128];
+};
+
+constexpr TablaPuntos construirTablaPuntos() {
+  TablaPuntos tabla{};
+  for (int bloque = 0; bloque < 4; ++bloque) {
+    for (int m = 0; m < 128; ++m) {
+      int suma = 0;
+      for (int bit = 0; bit < 7; ++bit) {
+        if (m >> bit & 1) {
+          suma += PIP_MENOR[bloque * 7 + bit] + PIP_MAYOR[bloque * 7 + bit];
+        }
+      }
+      tabla.puntos[bloque][m] = static_cast<int16_t>(suma);
+    }
+  }
+  return tabla;
+}
+
+constexpr TablaPuntos PUNTOS_POR_BLOQUE = construirTablaPuntos();
+
+} // namespace
+
+int sumaPuntos(uint32_t mascara) {
+  return PUNTOS_POR_BLOQUE.puntos[0][mascara & 127] + PUNTOS_POR_BLOQUE.puntos[1][(mascara >> 7) & 127] +
+         PUNTOS_POR_BLOQUE.puntos[2][(mascara >> 14) & 127] + PUNTOS_POR_BLOQUE.puntos[3][(mascara >> 21) & 127];
+}
+
+int idFicha(int a, int b) {
+  if (a > b) {
+    std::swap(a, b);
+  }
+  // Fichas anteriores a la fila 'a': 7 + 6 + ... + (7 - a + 1)
+  return a * 7 - a * (a - 1) / 2 + (b - a);
+}
+
+std::string textoFicha(int ficha, bool volteada) {
+  int izquierdo = volteada ? PIP_MAYOR[ficha] : PIP_MENOR[ficha];
+  int derecho = volteada ? PIP_MENOR[ficha] : PIP_MAYOR[ficha];
+  return "[" + std::to_string(izquierdo) + "|" + std::to_string(derecho) + "]";
+}
+
+// ========== GENERADOR ==========
+
+namespace {
+
+uint64_t splitmix64(uint64_t &x) {
+  uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+uint64_t rotar(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+} // namespace
+
+GeneradorDomino::GeneradorDomino(uint64_t semilla) {
+  for (uint64_t &palabra : estado) {
+    palabra = splitmix64(semilla);
+  }
+}
+
+GeneradorDomino::result_type GeneradorDomino::operator()() {
+  uint64_t resultado = rotar(estado[1] * 5, 7) * 9;
+  uint64_t t = estado[1] << 17;
+  estado[2] ^= estado[0];
+  estado[3] ^= estado[1];
+  estado[1] ^= estado[2];
+  estado[0] ^= estado[3];
+  estado[2] ^= t;
+  estado[3] = rotar(estado[3], 45);
+  return resultado;
+}
+
+uint32_t GeneradorDomino::menorQue(uint32_t n) {
+  uint64_t producto = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * n;
+  uint32_t bajo = static_cast<uint32_t>(producto);
+  if (bajo < n) {
+    uint32_t umbral = static_cast<uint32_t>(-n) % n;
+    while (bajo < umbral) {
+      producto = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * n;
+      bajo = static_cast<uint32_t>(producto);
+    }
+  }
+  return static_cast<uint32_t>(producto >> 32);
+}
+
+// ========== ESTADO ==========
+
+EstadoDomino::EstadoDomino()
+    : manos(), fichasJugadas(0), numJugadores(0), extremoIzquierdo(-1), extremoDerecho(-1), turno(0),
+      pasesConsecutivos(0), ganador(-1), tranca(false), terminado(false), valoresFaltantes(),
+      cantidadJugadas(0) {}
+
+void EstadoDomino::repartir(int jugadores, GeneradorDomino &generador, int primerTurno) {
+  if (jugadores < 2 || jugadores > MAXIMO_JUGADORES) {
+    throw std::invalid_argument("El número de jugadores debe estar entre 2 y 4");
+  }
+  int8_t pozo[CANTIDAD_FICHAS];
+  for (int i = 0; i < CANTIDAD_FICHAS; ++i) {
+    pozo[i] = static_cast<int8_t>(i);
+  }
+  // Fisher-Yates: solo hacen falta las primeras 7 * jugadores posiciones
+  int repartidas = jugadores * FICHAS_POR_JUGADOR;
+  for (int i = 0; i < repartidas; ++i) {
+    int j = i + static_cast<int>(generador.menorQue(CANTIDAD_FICHAS - i));
+    std::swap(pozo[i], pozo[j]);
+  }
+
+  *this = EstadoDomino();
+  numJugadores = static_cast<int8_t>(jugadores);
+  for (int i = 0; i < repartidas; ++i) {
+    manos[i / FICHAS_POR_JUGADOR] |= 1u << pozo[i];
+  }
+  turno = static_cast<int8_t>(primerTurno % jugadores);
+}
+
+void EstadoDomino::repartir(const std::vector<std::vector<int>> &manosIniciales, int primerTurno) {
+  int jugadores = static_cast<int>(manosIniciales.size());
+  if (jugadores < 2 || jugadores > MAXIMO_JUGADORES) {
+    throw std::invalid_argument("El número de jugadores debe estar entre 2 y 4");
+  }
+  uint32_t vistas = 0;
+  *this = EstadoDomino();
+  numJugadores = static_cast<int8_t>(jugadores);
+  for (int j = 0; j < jugadores; ++j) {
+    // Con una mano vacía la partida ya estaría terminada antes de empezar
+    if (manosIniciales[j].empty() || manosIniciales[j].size() > FICHAS_POR_JUGADOR) {
+      throw std::invalid_argument("Cada mano debe tener entre 1 y 7 fichas");
+    }
+    for (int ficha : manosIniciales[j]) {
+      if (ficha < 0 || ficha >= CANTIDAD_FICHAS || (vistas >> ficha & 1u)) {
+        throw std::invalid_argument("Ficha inválida o repetida en las manos");
+      }
+      vistas |= 1u << ficha;
+      manos[j] |= 1u << ficha;
+    }
+  }
+  turno = static_cast<int8_t>(primerTurno % jugadores);
+}
+
+// Con el tablero vacío se juega cualquier ficha; si no, las que llevan el
+// valor de cada extremo. Los movimientos salen en orden de ficha y, para una
+// misma ficha, primero el de la izquierda.
+void EstadoDomino::movimientosLegales(ListaMovimientos &lista) const {
+  lista.cantidad = 0;
+  if (terminado) {
+    return;
+  }
+  uint32_t mano = manos[turno];
+  if (extremoIzquierdo < 0) {
+    for (uint32_t resto = mano; resto != 0; resto &= resto - 1) {
+      lista.movimientos[lista.cantidad++] = Movimiento{static_cast<int8_t>(primeraFicha(resto)), Lado::Izquierda};
+    }
+    return;
+  }
+  uint32_t izquierda = mano & MASCARA_PIP[extremoIzquierdo];
+  uint32_t derecha = mano & MASCARA_PIP[extremoDerecho];
+  for (uint32_t resto = izquierda | derecha; resto != 0; resto &= resto - 1) {
+    int ficha = primeraFicha(resto);
+    if (izquierda >> ficha & 1u) {
+      lista.movimientos[lista.cantidad++] = Movimiento{static_cast<int8_t>(ficha), Lado::Izquierda};
+    }
+    if (derecha >> ficha & 1u) {
+      lista.movimientos[lista.cantidad++] = Movimiento{static_cast<int8_t>(ficha), Lado::Derecha};
+    }
+  }
+}
+
+void EstadoDomino::movimientosSinSimetricos(ListaMovimientos &lista) const {
+  movimientosLegales(lista);
+  if (extremoIzquierdo < 0 || extremoIzquierdo != extremoDerecho) {
+    return;
+  }
+  int cantidad = 0;
+  for (int i = 0; i < lista.cantidad; ++i) {
+    if (lista.movimientos[i].lado == Lado::Izquierda) {
+      lista.movimientos[cantidad++] = lista.movimientos[i];
+    }
+  }
+  lista.cantidad = cantidad;
+}
+
+uint32_t EstadoDomino::fichasJugables() const {
+  if (terminado) {
+    return 0;
+  }
+  if (extremoIzquierdo < 0) {
+    return manos[turno];
+  }
+  return manos[turno] & (MASCARA_PIP[extremoIzquierdo] | MASCARA_PIP[extremoDerecho]);
+}
+
+bool EstadoDomino::esLegal(Movimiento movimiento) const {
+  if (terminado || movimiento.ficha < 0 || movimiento.ficha >= CANTIDAD_FICHAS ||
+      !tieneFicha(turno, movimiento.ficha)) {
+    return false;
+  }
+  if (extremoIzquierdo < 0) {
+    return true;
+  }
+  int extremo = movimiento.lado == Lado::Izquierda ? extremoIzquierdo : extremoDerecho;
+  return MASCARA_PIP[extremo] >> movimiento.ficha & 1u;
+}
+
+// Misma orientación que dominoConHistorial.cpp: a la izquierda se prefiere que
+// el valor mayor toque el extremo, a la derecha el menor; si no, se voltea
+Jugada EstadoDomino::jugar(Movimiento movimiento) {
+  int ficha = movimiento.ficha;
+  int menor = PIP_MENOR[ficha];
+  int mayor = PIP_MAYOR[ficha];
+  Jugada jugada{turno, movimiento.ficha, movimiento.lado, false};
+
+  if (extremoIzquierdo < 0) {
+    extremoIzquierdo = static_cast<int8_t>(menor);
+    extremoDerecho = static_cast<int8_t>(mayor);
+    jugada.lado = Lado::Derecha;
+  } else if (movimiento.lado == Lado::Izquierda) {
+    jugada.volteada = mayor != extremoIzquierdo;
+    extremoIzquierdo = static_cast<int8_t>(jugada.volteada ? mayor : menor);
+  } else {
+    jugada.volteada = menor != extremoDerecho;
+    extremoDerecho = static_cast<int8_t>(jugada.volteada ? menor : mayor);
+  }
+
+  manos[turno] &= ~(1u << ficha);
+  fichasJugadas |= 1u << ficha;
+  cantidadJugadas++;
+  pasesConsecutivos = 0;
+
+  if (manos[turno] == 0) {
+    terminar(turno, false);
+  } else {
+    turno = static_cast<int8_t>((turno + 1) % numJugadores);
+  }
+  return jugada;
+}
+
+void EstadoDomino::pasar() {
+  // Con el tablero vacío (extremos en -1) pasar no revela ningún valor
+  if (extremoIzquierdo >= 0) {
+    valoresFaltantes[turno] |= static_cast<uint8_t>((1u << extremoIzquierdo) | (1u << extremoDerecho));
+  }
+  pasesConsecutivos++;
+  if (pasesConsecutivos >= numJugadores) {
+    int menor = sumaPuntosMano(0);
+    int indice = 0;
+    for (int j = 1; j < numJugadores; ++j) {
+      int puntos = sumaPuntosMano(j);
+      if (puntos < menor) {
+        menor = puntos;
+        indice = j;
+      }
+    }
+    terminar(indice, true);
+  } else {
+    turno = static_cast<int8_t>((turno + 1) % numJugadores);
+  }
+}
+
+void EstadoDomino::terminar(int jugadorGanador, bool porTranca) {
+  ganador = static_cast<int8_t>(jugadorGanador);
+  tranca = porTranca;
+  terminado = true;
+}
+
+int EstadoDomino::obtenerFichaDeMano(int jugador, int indice) const {
+  uint32_t resto = manos[jugador];
+  for (int i = 0; i < indice; ++i) {
+    resto &= resto - 1;
+  }
+  return resto != 0 ? primeraFicha(resto) : -1;
+}
+
+// ========== POLÍTICAS ==========
+
+Movimiento PoliticaAleatoria::elegir(const EstadoDomino &, const ListaMovimientos &legales,
+                                     GeneradorDomino &generador) {
+  return legales[static_cast<int>(generador.menorQue(static_cast<uint32_t>(legales.cantidad)))];
+}
+
+Movimiento PoliticaGolosa::elegir(const EstadoDomino &, const ListaMovimientos &legales, GeneradorDomino &) {
+  Movimiento mejor = legales[0];
+  for (const Movimiento &movimiento : legales) {
+    if (PIP_MENOR[movimiento.ficha] + PIP_MAYOR[movimiento.ficha] >
+        PIP_MENOR[mejor.ficha] + PIP_MAYOR[mejor.ficha]) {
+      mejor = movimiento;
+    }
+  }
+  return mejor;
+}
+
+// ========== MOTOR ==========
+
+MotorDomino::MotorDomino(const std::vector<PoliticaDomino *> &politicas) : politicas(politicas) {
+  if (politicas.size() < 2 || politicas.size() > MAXIMO_JUGADORES) {
+    throw std::invalid_argument("El número de jugadores debe estar entre 2 y 4");
+  }
+}
+
+void MotorDomino::agregarObservador(ObservadorDomino *observador) { observadores.push_back(observador); }
+
+ResultadoPartida MotorDomino::jugarPartida(GeneradorDomino &generador, int primerTurno) {
+  EstadoDomino inicial;
+  inicial.repartir(obtenerNumJugadores(), generador, primerTurno);
+  return jugarDesde(inicial, generador);
+}
+
+ResultadoPartida MotorDomino::jugarDesde(const EstadoDomino &inicial, GeneradorDomino &generador) {
+  if (inicial.obtenerNumJugadores() != obtenerNumJugadores()) {
+    throw std::invalid_argument("El estado no tiene la misma cantidad de jugadores que el motor");
+  }
+  estado = inicial;
+  for (ObservadorDomino *observador : observadores) {
+    observador->alIniciar(estado);
+  }
+
+  ResultadoPartida resultado;
+  ListaMovimientos legales;
+  while (!estado.estaTerminado()) {
+    for (ObservadorDomino *observador : observadores) {
+      observador->alComenzarTurno(estado);
+    }
+    int jugador = estado.obtenerTurno();
+    estado.movimientosLegales(legales);
+    if (legales.vacia()) {
+      estado.pasar();
+      resultado.pases++;
+      for (ObservadorDomino *observador : observadores) {
+        observador->alPasar(estado, jugador);
+      }
+      continue;
+    }
+
+    Movimiento elegido = politicas[jugador]->elegir(estado, legales, generador);
+    if (std::find(legales.begin(), legales.end(), elegido) == legales.end()) {
+      throw std::logic_error("La política devolvió un movimiento que no es legal");
+    }
+    Jugada jugada = estado.jugar(elegido);
+    resultado.jugadas++;
+    for (ObservadorDomino *observador : observadores) {
+      observador->alJugar(estado, jugada);
+    }
+  }
+
+  resultado.ganador = estado.obtenerGanador();
+  resultado.tranca = estado.terminoPorTranca();
+  for (int j = 0; j < estado.obtenerNumJugadores(); ++j) {
+    resultado.puntos[j] = estado.sumaPuntosMano(j);
+  }
+  for (ObservadorDomino *observador : observadores) {
+    observador->alTerminar(estado, resultado);
+  }
+  return resultado;
+}
@@ -0,0 +1,293 @@
+/**
+ * @file MotorDomino.h
+ * @brief Motor de dominó sin consola: estado compacto, jugadores enchufables y observadores.
+ *
+ * Las reglas son las de dominoConHistorial.cpp: doble seis, 2 a 4 jugadores con
+ * 7 fichas cada uno (el resto queda fuera del juego), sin robar del pozo. Quien
+ * no puede jugar pasa; gana quien se queda sin fichas o, si el juego se tranca
+ * (todos pasan seguidos), quien suma menos puntos en la mano (el primero en
+ * caso de empate).
+ */
+
+#ifndef MOTOR_DOMINO_H
+#define MOTOR_DOMINO_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Las 28 fichas se numeran en el orden en que se generan: [0|0], [0|1], ...,
+// [0|6], [1|1], ..., [6|6]. PIP_MENOR/PIP_MAYOR dan sus dos valores.
+constexpr int CANTIDAD_FICHAS = 28;
+constexpr int MAXIMO_JUGADORES = 4;
+constexpr int FICHAS_POR_JUGADOR = 7;
+constexpr int MAXIMO_MOVIMIENTOS = 2 * FICHAS_POR_JUGADOR; // Cada ficha por cada lado
+
+inline constexpr int8_t PIP_MENOR[CANTIDAD_FICHAS] = {0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2,
+                                                      2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 6};
+inline constexpr int8_t PIP_MAYOR[CANTIDAD_FICHAS] = {0, 1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6, 2,
+                                                      3, 4, 5, 6, 3, 4, 5, 6, 4, 5, 6, 5, 6, 6};
+
+// Manos y conjuntos de fichas como máscaras de 28 bits (bit f = ficha f).
+// MASCARA_PIP[v] tiene las 7 fichas que llevan el valor v.
+constexpr uint32_t TODAS_LAS_FICHAS = (1u << CANTIDAD_FICHAS) - 1;
+
+constexpr uint32_t mascaraDePip(int valor) {
+  uint32_t mascara = 0;
+  for (int f = 0; f < CANTIDAD_FICHAS; ++f) {
+    if (PIP_MENOR[f] == valor || PIP_MAYOR[f] == valor) {
+      mascara |= 1u << f;
+    }
+  }
+  return mascara;
+}
+
+inline constexpr uint32_t MASCARA_PIP[7] = {mascaraDePip(0), mascaraDePip(1), mascaraDePip(2), mascaraDePip(3),
+                                            mascaraDePip(4), mascaraDePip(5), mascaraDePip(6)};
+
+/// Cantidad de fichas de una máscara
+inline int contarFichas(uint32_t mascara) { return __builtin_popcount(mascara); }
+
+/// Ficha de menor número de una máscara no vacía
+inline int primeraFicha(uint32_t mascara) { return __builtin_ctz(mascara); }
+
+/// Suma de puntos de las fichas de una máscara (cuatro consultas a tabla)
+int sumaPuntos(uint32_t mascara);
+
+/// Número de la ficha con los valores dados (en cualquier orden)
+int idFicha(int a, int b);
+
+/// Texto "[a|b]" de la ficha, con los valores invertidos si está volteada
+std::string textoFicha(int ficha, bool volteada = false);
+
+/**
+ * @class GeneradorDomino
+ * @brief Generador pseudoaleatorio xoshiro256** (rápido, 256 bits de estado).
+ *
+ * Cumple los requisitos de UniformRandomBitGenerator. La semilla se expande con
+ * splitmix64, así semillas consecutivas dan secuencias independientes.
+ */
+class GeneradorDomino {
+private:
+  uint64_t estado[4];
+
+public:
+  using result_type = uint64_t;
+
+  explicit GeneradorDomino(uint64_t semilla = 0x9E3779B97F4A7C15ULL);
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return UINT64_MAX; }
+
+  result_type operator()();
+
+  /// Entero uniforme en [0, n) (método de Lemire, sin divisiones en el caso común)
+  uint32_t menorQue(uint32_t n);
+};
+
+/// Lado del tablero donde se coloca una ficha
+enum class Lado : uint8_t { Izquierda, Derecha };
+
+/**
+ * @struct Movimiento
+ * @brief Ficha a jugar y lado del tablero. Con el tablero vacío el lado no importa.
+ */
+struct Movimiento {
+  int8_t ficha;
+  Lado lado;
+
+  bool operator==(const Movimiento &otro) const { return ficha == otro.ficha && lado == otro.lado; }
+  bool operator!=(const Movimiento &otro) const { return !(*this == otro); }
+};
+
+/**
+ * @struct Jugada
+ * @brief Movimiento ya aplicado: quién lo hizo y cómo quedó orientada la ficha.
+ *
+ * volteada indica que en el tablero la ficha se lee [mayor|menor].
+ */
+struct Jugada {
+  int8_t jugador;
+  int8_t ficha;
+  Lado lado;
+  bool volteada;
+};
+
+/**
+ * @struct ListaMovimientos
+ * @brief Movimientos legales de un turno, sin memoria dinámica.
+ */
+struct ListaMovimientos {
+  Movimiento movimientos[MAXIMO_MOVIMIENTOS];
+  int cantidad = 0;
+
+  const Movimiento *begin() const { return movimientos; }
+  const Movimiento *end() const { return movimientos + cantidad; }
+  const Movimiento &operator[](int i) const { return movimientos[i]; }
+  bool vacia() const { return cantidad == 0; }
+};
+
+/**
+ * @class EstadoDomino
+ * @brief Estado completo de una partida; se copia con un memcpy (útil para búsquedas).
+ *
+ * Información pública: extremos del tablero, fichas jugadas, tamaño de cada mano
+ * y los valores que cada jugador reveló no tener al pasar. La mano de cada
+ * jugador es privada: un jugador honesto solo consulta la suya.
+ *
+ * Cada mano es una máscara de 28 bits: las fichas jugables son
+ * mano & MASCARA_PIP[extremo] y los puntos salen de una tabla. Las fichas de
+ * una mano se recorren en orden de número.
+ */
+class EstadoDomino {
+private:
+  uint32_t manos[MAXIMO_JUGADORES];
+  uint32_t fichasJugadas; // Bit f: la ficha f está en el tablero
+  int8_t numJugadores;
+  int8_t extremoIzquierdo; // -1 con el tablero vacío
+  int8_t extremoDerecho;
+  int8_t turno;
+  int8_t pasesConsecutivos;
+  int8_t ganador; // -1 mientras no termina
+  bool tranca;
+  bool terminado;
+  uint8_t valoresFaltantes[MAXIMO_JUGADORES]; // Bit v: el jugador pasó con v en un extremo
+  int16_t cantidadJugadas;
+
+  void terminar(int jugadorGanador, bool porTranca);
+
+public:
+  EstadoDomino();
+
+  /// Barajar las 28 fichas y repartir 7 a cada jugador; empieza 'primerTurno'
+  void repartir(int jugadores, GeneradorDomino &generador, int primerTurno = 0);
+
+  /// Repartir manos dadas (listas de números de ficha, de 1 a 7 elementos).
+  /// Lanza std::invalid_argument si las manos no son válidas.
+  void repartir(const std::vector<std::vector<int>> &manosIniciales, int primerTurno = 0);
+
+  /// Movimientos legales del jugador de turno (vacío si debe pasar o terminó)
+  void movimientosLegales(ListaMovimientos &lista) const;
+  /// Como movimientosLegales, pero si los dos extremos son iguales deja solo los
+  /// de la izquierda (el otro lado da la misma posición reflejada). Para búsquedas.
+  void movimientosSinSimetricos(ListaMovimientos &lista) const;
+  /// Fichas del jugador de turno que se pueden jugar en algún extremo
+  uint32_t fichasJugables() const;
+  bool esLegal(Movimiento movimiento) const;
+
+  /// Aplicar un movimiento legal del jugador de turno y pasar al siguiente
+  Jugada jugar(Movimiento movimiento);
+
+  /// El jugador de turno pasa (solo si no tiene movimientos legales)
+  void pasar();
+
+  int obtenerNumJugadores() const { return numJugadores; }
+  int obtenerTurno() const { return turno; }
+  int obtenerExtremoIzquierdo() const { return extremoIzquierdo; }
+  int obtenerExtremoDerecho() const { return extremoDerecho; }
+  bool tableroVacio() const { return extremoIzquierdo < 0; }
+  int obtenerPasesConsecutivos() const { return pasesConsecutivos; }
+  bool estaTerminado() const { return terminado; }
+  bool terminoPorTranca() const { return tranca; }
+  int obtenerGanador() const { return ganador; }
+  uint32_t obtenerFichasJugadas() const { return fichasJugadas; }
+  int obtenerCantidadJugadas() const { return cantidadJugadas; }
+  uint8_t obtenerValoresFaltantes(int jugador) const { return valoresFaltantes[jugador]; }
+
+  uint32_t obtenerMano(int jugador) const { return manos[jugador]; }
+  int obtenerTamanioMano(int jugador) const { return contarFichas(manos[jugador]); }
+  /// Ficha número 'indice' de la mano, contando en orden de número de ficha
+  int obtenerFichaDeMano(int jugador, int indice) const;
+  bool tieneFicha(int jugador, int ficha) const { return manos[jugador] >> ficha & 1u; }
+
+  /// Reemplazar la mano de un jugador, por ejemplo por una muestra de las fichas
+  /// que no se ven. No se valida: la mano nueva no debe tener fichas jugadas ni
+  /// de otras manos, y debe conservar la cantidad para que el estado sea coherente.
+  void establecerMano(int jugador, uint32_t mano) { manos[jugador] = mano; }
+  int sumaPuntosMano(int jugador) const { return sumaPuntos(manos[jugador]); }
+};
+
+/**
+ * @class PoliticaDomino
+ * @brief Estrategia de un jugador: elige uno de los movimientos legales.
+ */
+class PoliticaDomino {
+public:
+  virtual ~PoliticaDomino() = default;
+
+  /// 'legales' nunca está vacía; se debe devolver uno de sus elementos
+  virtual Movimiento elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                            GeneradorDomino &generador) = 0;
+};
+
+/// Juega un movimiento legal al azar
+class PoliticaAleatoria : public PoliticaDomino {
+public:
+  Movimiento elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                    GeneradorDomino &generador) override;
+};
+
+/// Juega la ficha de más puntos ("botar la gorda"); a igualdad, la primera
+class PoliticaGolosa : public PoliticaDomino {
+public:
+  Movimiento elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                    GeneradorDomino &generador) override;
+};
+
+/**
+ * @struct ResultadoPartida
+ * @brief Resumen de una partida terminada.
+ */
+struct ResultadoPartida {
+  int ganador = -1;
+  bool tranca = false;
+  int jugadas = 0;
+  int pases = 0;
+  int puntos[MAXIMO_JUGADORES] = {0, 0, 0, 0}; // Puntos que quedaron en cada mano
+};
+
+/**
+ * @class ObservadorDomino
+ * @brief Recibe los eventos de una partida (consola, historial, estadísticas).
+ *
+ * Todos los métodos tienen implementación vacía; se redefinen solo los necesarios.
+ */
+class ObservadorDomino {
+public:
+  virtual ~ObservadorDomino() = default;
+  virtual void alIniciar(const EstadoDomino &) {}
+  virtual void alComenzarTurno(const EstadoDomino &) {}
+  virtual void alJugar(const EstadoDomino &, const Jugada &) {}
+  virtual void alPasar(const EstadoDomino &, int) {}
+  virtual void alTerminar(const EstadoDomino &, const ResultadoPartida &) {}
+};
+
+/**
+ * @class MotorDomino
+ * @brief Ejecuta partidas entre políticas, sin entrada/salida propia.
+ *
+ * Las políticas y observadores no se copian: deben vivir más que el motor.
+ */
+class MotorDomino {
+private:
+  std::vector<PoliticaDomino *> politicas;
+  std::vector<ObservadorDomino *> observadores;
+  EstadoDomino estado;
+
+public:
+  /// Lanza std::invalid_argument si no hay entre 2 y 4 políticas
+  explicit MotorDomino(const std::vector<PoliticaDomino *> &politicas);
+
+  void agregarObservador(ObservadorDomino *observador);
+
+  /// Repartir y jugar una partida completa
+  ResultadoPartida jugarPartida(GeneradorDomino &generador, int primerTurno = 0);
+
+  /// Jugar desde un estado ya repartido hasta el final
+  ResultadoPartida jugarDesde(const EstadoDomino &inicial, GeneradorDomino &generador);
+
+  const EstadoDomino &obtenerEstado() const { return estado; }
+  int obtenerNumJugadores() const { return static_cast<int>(politicas.size()); }
+};
+
+#endif // MOTOR_DOMINO_H
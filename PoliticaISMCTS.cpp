@@ -0,0 +1,277 @@
+/**
+ * @file PoliticaISMCTS.cpp
+ * @brief Implementación del jugador ISMCTS.
+ */
+
+#include "PoliticaISMCTS.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int MAXIMO_CAMINO = 128; // Jugadas y pases de una partida, con margen
+
+// k fichas al azar de una máscara con al menos k fichas
+uint32_t elegirFichas(uint32_t disponibles, int k, GeneradorDomino &generador) {
+  uint32_t elegidas = 0;
+  for (int i = 0; i < k; ++i) {
+    uint32_t resto = disponibles;
+    for (uint32_t salto = generador.menorQue(static_cast<uint32_t>(contarFichas(disponibles))); salto > 0; --salto) {
+      resto &= resto - 1;
+    }
+    uint32_t ficha = resto & (~resto + 1);
+    elegidas |= ficha;
+    disponibles &= ~ficha;
+  }
+  return elegidas;
+}
+
+void aplicar(EstadoDomino &estado, Movimiento movimiento) {
+  if (movimiento.ficha < 0) {
+    estado.pasar();
+  } else {
+    estado.jugar(movimiento);
+  }
+}
+
+} // namespace
+
+PoliticaISMCTS::PoliticaISMCTS(double segundosPorMovimiento, int hilos, long limiteIteraciones, int capacidadNodos)
+    : segundosPorMovimiento(segundosPorMovimiento),
+      hilos(hilos > 0 ? hilos : std::max(1, static_cast<int>(std::thread::hardware_concurrency()))),
+      limiteIteraciones(limiteIteraciones), exploracion(0.7), capacidad(std::max(16, capacidadNodos)),
+      nodos(new Nodo[std::max(16, capacidadNodos)]), nodosUsados(0) {
+  if (segundosPorMovimiento <= 0 && limiteIteraciones <= 0) {
+    this->limiteIteraciones = 1000;
+  }
+}
+
+// Reparte las fichas que el jugador de turno no ve. Los rivales con menos
+// margen (fichas posibles menos fichas que tienen) eligen primero; si aun así
+// uno se queda sin fichas posibles se reintenta, y como último recurso se
+// ignoran los pases (no debería pasar si los pases vienen de una partida real).
+EstadoDomino PoliticaISMCTS::determinizar(const EstadoDomino &estado, GeneradorDomino &generador) {
+  EstadoDomino muestra = estado;
+  int observador = estado.obtenerTurno();
+  uint32_t noVistas = TODAS_LAS_FICHAS & ~estado.obtenerMano(observador) & ~estado.obtenerFichasJugadas();
+
+  int rivales[MAXIMO_JUGADORES];
+  uint32_t prohibidas[MAXIMO_JUGADORES] = {0, 0, 0, 0};
+  int cantidadRivales = 0;
+  for (int j = 0; j < estado.obtenerNumJugadores(); ++j) {
+    if (j == observador) {
+      continue;
+    }
+    for (int v = 0; v <= 6; ++v) {
+      if (estado.obtenerValoresFaltantes(j) >> v & 1) {
+        prohibidas[j] |= MASCARA_PIP[v];
+      }
+    }
+    rivales[cantidadRivales++] = j;
+  }
+  auto margen = [&](int j) { return contarFichas(noVistas & ~prohibidas[j]) - estado.obtenerTamanioMano(j); };
+  for (int i = 1; i < cantidadRivales; ++i) { // Inserción: a lo sumo 3 rivales
+    for (int k = i; k > 0 && margen(rivales[k]) < margen(rivales[k - 1]); --k) {
+      std::swap(rivales[k], rivales[k - 1]);
+    }
+  }
+
+  for (int intento = 0; intento <= 16; ++intento) {
+    bool respetarPases = intento < 16;
+    uint32_t restantes = noVistas;
+    bool posible = true;
+    for (int i = 0; i < cantidadRivales && posible; ++i) {
+      int j = rivales[i];
+      uint32_t permitidas = respetarPases ? restantes & ~prohibidas[j] : restantes;
+      int necesarias = estado.obtenerTamanioMano(j);
+      if (contarFichas(permitidas) < necesarias) {
+        posible = false;
+        break;
+      }
+      uint32_t mano = elegirFichas(permitidas, necesarias, generador);
+      restantes &= ~mano;
+      muestra.establecerMano(j, mano);
+    }
+    if (posible) {
+      break;
+    }
+  }
+  return muestra;
+}
+
+int32_t PoliticaISMCTS::nuevoNodo(Movimiento movimiento, int jugador) {
+  int32_t indice = nodosUsados.fetch_add(1, std::memory_order_relaxed);
+  if (indice >= capacidad) {
+    return -1;
+  }
+  Nodo &nodo = nodos[indice];
+  nodo.movimiento = movimiento;
+  nodo.jugador = static_cast<int8_t>(jugador);
+  nodo.hermano = -1;
+  nodo.primerHijo.store(-1, std::memory_order_relaxed);
+  nodo.visitas.store(0, std::memory_order_relaxed);
+  nodo.victorias.store(0, std::memory_order_relaxed);
+  nodo.disponible.store(0, std::memory_order_relaxed);
+  return indice;
+}
+
+int32_t PoliticaISMCTS::buscarHijo(int32_t padre, Movimiento movimiento) const {
+  for (int32_t hijo = nodos[padre].primerHijo.load(std::memory_order_acquire); hijo >= 0;
+       hijo = nodos[hijo].hermano) {
+    if (nodos[hijo].movimiento == movimiento) {
+      return hijo;
+    }
+  }
+  return -1;
+}
+
+void PoliticaISMCTS::iterar(const EstadoDomino &raiz, GeneradorDomino &generador) {
+  EstadoDomino estado = determinizar(raiz, generador);
+  int32_t camino[MAXIMO_CAMINO];
+  int largo = 0;
+  int32_t actual = 0;
+  nodos[0].visitas.fetch_add(1, std::memory_order_relaxed);
+
+  // Selección y expansión
+  ListaMovimientos lista;
+  while (!estado.estaTerminado() && largo < MAXIMO_CAMINO) {
+    estado.movimientosSinSimetricos(lista);
+    if (lista.vacia()) {
+      lista.movimientos[0] = Movimiento{-1, Lado::Izquierda}; // Pase
+      lista.cantidad = 1;
+    }
+    int jugador = estado.obtenerTurno();
+
+    Movimiento sinProbar[MAXIMO_MOVIMIENTOS];
+    int cantidadSinProbar = 0;
+    int32_t elegido = -1;
+    double mejorPuntaje = -1;
+    for (const Movimiento &movimiento : lista) {
+      int32_t hijo = buscarHijo(actual, movimiento);
+      if (hijo < 0) {
+        sinProbar[cantidadSinProbar++] = movimiento;
+        continue;
+      }
+      Nodo &nodo = nodos[hijo];
+      int disponible = nodo.disponible.fetch_add(1, std::memory_order_relaxed) + 1;
+      int visitas = nodo.visitas.load(std::memory_order_relaxed);
+      double puntaje = visitas == 0 ? 1e9
+                                    : double(nodo.victorias.load(std::memory_order_relaxed)) / visitas +
+                                          exploracion * std::sqrt(std::log(double(disponible)) / visitas);
+      if (puntaje > mejorPuntaje) {
+        mejorPuntaje = puntaje;
+        elegido = hijo;
+      }
+    }
+
+    if (cantidadSinProbar > 0) {
+      Movimiento movimiento = sinProbar[generador.menorQue(static_cast<uint32_t>(cantidadSinProbar))];
+      int32_t hijo;
+      {
+        std::lock_guard<std::mutex> bloqueo(candados[actual & 63]);
+        hijo = buscarHijo(actual, movimiento); // Otro hilo pudo expandirlo recién
+        if (hijo < 0) {
+          hijo = nuevoNodo(movimiento, jugador);
+          if (hijo >= 0) {
+            nodos[hijo].disponible.store(1, std::memory_order_relaxed);
+            nodos[hijo].hermano = nodos[actual].primerHijo.load(std::memory_order_relaxed);
+            nodos[actual].primerHijo.store(hijo, std::memory_order_release);
+          }
+        }
+      }
+      aplicar(estado, movimiento);
+      if (hijo >= 0) {
+        nodos[hijo].visitas.fetch_add(1, std::memory_order_relaxed); // Pérdida virtual
+        camino[largo++] = hijo;
+      }
+      break;
+    }
+
+    aplicar(estado, nodos[elegido].movimiento);
+    nodos[elegido].visitas.fetch_add(1, std::memory_order_relaxed); // Pérdida virtual
+    camino[largo++] = elegido;
+    actual = elegido;
+  }
+
+  // Simulación al azar hasta el final
+  while (!estado.estaTerminado()) {
+    estado.movimientosLegales(lista);
+    if (lista.vacia()) {
+      estado.pasar();
+    } else {
+      estado.jugar(lista[static_cast<int>(generador.menorQue(static_cast<uint32_t>(lista.cantidad)))]);
+    }
+  }
+
+  // Retropropagación: las visitas ya se sumaron al bajar
+  int ganador = estado.obtenerGanador();
+  for (int i = 0; i < largo; ++i) {
+    if (nodos[camino[i]].jugador == ganador) {
+      nodos[camino[i]].victorias.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+Movimiento PoliticaISMCTS::elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                                  GeneradorDomino &generador) {
+  ultima = EstadisticasISMCTS();
+  if (legales.cantidad == 1) {
+    return legales[0];
+  }
+
+  auto inicio = std::chrono::steady_clock::now();
+  nodosUsados.store(0);
+  nuevoNodo(Movimiento{-1, Lado::Izquierda}, -1);
+
+  std::vector<uint64_t> semillas(hilos);
+  for (uint64_t &semilla : semillas) {
+    semilla = generador();
+  }
+  std::atomic<long> iteraciones(0);
+  std::atomic<long> completadas(0);
+  auto trabajar = [&](int t) {
+    GeneradorDomino propio(semillas[t]);
+    long propias = 0;
+    for (long i = iteraciones.fetch_add(1);; i = iteraciones.fetch_add(1)) {
+      if (limiteIteraciones > 0 && i >= limiteIteraciones) {
+        break;
+      }
+      if (segundosPorMovimiento > 0 && (i & 15) == 0 &&
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count() >= segundosPorMovimiento) {
+        break;
+      }
+      iterar(estado, propio);
+      propias++;
+    }
+    completadas += propias;
+  };
+  std::vector<std::thread> trabajadores;
+  for (int t = 1; t < hilos; ++t) {
+    trabajadores.emplace_back(trabajar, t);
+  }
+  trabajar(0);
+  for (std::thread &trabajador : trabajadores) {
+    trabajador.join();
+  }
+
+  // El más visitado entre los movimientos legales de la raíz
+  Movimiento mejor = legales[0];
+  int mejorVisitas = -1;
+  int victorias = 0;
+  for (int32_t hijo = nodos[0].primerHijo.load(); hijo >= 0; hijo = nodos[hijo].hermano) {
+    int visitas = nodos[hijo].visitas.load();
+    if (visitas > mejorVisitas) {
+      mejorVisitas = visitas;
+      victorias = nodos[hijo].victorias.load();
+      mejor = nodos[hijo].movimiento;
+    }
+  }
+
+  ultima.iteraciones = completadas.load();
+  ultima.nodos = std::min(nodosUsados.load(), capacidad);
+  ultima.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+  ultima.tasaVictoriaEstimada = mejorVisitas > 0 ? double(victorias) / mejorVisitas : 0;
+  return mejor;
+}
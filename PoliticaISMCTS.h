@@ -0,0 +1,92 @@
+/**
+ * @file PoliticaISMCTS.h
+ * @brief Jugador automático con información imperfecta (ISMCTS en varios hilos).
+ */
+
+#ifndef POLITICA_ISMCTS_H
+#define POLITICA_ISMCTS_H
+
+#include "MotorDomino.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+/**
+ * @struct EstadisticasISMCTS
+ * @brief Datos de la última búsqueda (para mostrar y ajustar el presupuesto).
+ */
+struct EstadisticasISMCTS {
+  long iteraciones = 0;
+  int nodos = 0;
+  double segundos = 0;
+  double tasaVictoriaEstimada = 0; // Del movimiento elegido
+};
+
+/**
+ * @class PoliticaISMCTS
+ * @brief Information-Set Monte Carlo Tree Search (un solo observador).
+ *
+ * Solo usa lo que el jugador de turno puede saber: su mano, las fichas jugadas,
+ * los extremos, cuántas fichas tiene cada rival y los valores que cada uno
+ * reveló no tener al pasar. En cada iteración:
+ *
+ * 1. Determinización: reparte las fichas no vistas entre los rivales (con sus
+ *    cantidades) respetando los pases: a un rival que pasó con un 4 en un
+ *    extremo nunca le toca una ficha con 4. Las que sobran quedan fuera del juego.
+ * 2. Selección: baja por el árbol común eligiendo, entre los hijos legales en
+ *    esa determinización, el de mayor UCB con conteo de disponibilidad.
+ * 3. Expansión de un movimiento no probado y simulación al azar hasta el final.
+ * 4. Retropropagación: cada nodo suma una victoria si ganó quien hizo su jugada.
+ *
+ * Varios hilos comparten el árbol. Los nodos están en un arreglo fijo con
+ * contadores atómicos; al bajar se suma la visita antes de conocer el
+ * resultado (pérdida virtual), así los hilos se reparten entre ramas en lugar
+ * de repetir la misma. Expandir un nodo toma uno de 64 mutex según el nodo.
+ *
+ * La búsqueda se corta por tiempo (segundosPorMovimiento) o por cantidad de
+ * iteraciones si se fija un límite; se juega el movimiento más visitado.
+ */
+class PoliticaISMCTS : public PoliticaDomino {
+private:
+  struct Nodo {
+    Movimiento movimiento;
+    int8_t jugador; // Quien hizo la jugada que lleva a este nodo
+    int32_t hermano;
+    std::atomic<int32_t> primerHijo;
+    std::atomic<int32_t> visitas;
+    std::atomic<int32_t> victorias;
+    std::atomic<int32_t> disponible;
+  };
+
+  double segundosPorMovimiento;
+  int hilos;
+  long limiteIteraciones;
+  double exploracion;
+  int capacidad;
+
+  std::unique_ptr<Nodo[]> nodos;
+  std::atomic<int32_t> nodosUsados;
+  std::mutex candados[64];
+  EstadisticasISMCTS ultima;
+
+  int32_t nuevoNodo(Movimiento movimiento, int jugador);
+  int32_t buscarHijo(int32_t padre, Movimiento movimiento) const;
+  void iterar(const EstadoDomino &raiz, GeneradorDomino &generador);
+
+public:
+  /// hilos = 0: uno por núcleo. limiteIteraciones = 0: solo por tiempo.
+  explicit PoliticaISMCTS(double segundosPorMovimiento = 0.05, int hilos = 0, long limiteIteraciones = 0,
+                          int capacidadNodos = 1 << 18);
+
+  Movimiento elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                    GeneradorDomino &generador) override;
+
+  /// Muestra de las manos ocultas para el jugador de turno, consistente con los pases
+  static EstadoDomino determinizar(const EstadoDomino &estado, GeneradorDomino &generador);
+
+  void establecerExploracion(double c) { exploracion = c; }
+  const EstadisticasISMCTS &obtenerUltimaBusqueda() const { return ultima; }
+};
+
+#endif // POLITICA_ISMCTS_H
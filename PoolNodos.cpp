@@ -0,0 +1,73 @@
+#include "PoolNodos.h"
+
+// Constructor - pool vacío, la primera página se pide con el primer nodo
+PoolNodos::PoolNodos(std::pmr::memory_resource* superior)
+    : superior(superior), libres(), cursor(nullptr), limite(nullptr), bytesEnUso(0) {}
+
+PoolNodos::~PoolNodos() {
+    liberar();
+}
+
+// Lista de libres de la clase si tiene bloques; si no, el siguiente bloque de
+// la página actual (o de una página nueva)
+void* PoolNodos::do_allocate(size_t bytes, size_t alineacion) {
+    if (bytes == 0) {
+        bytes = 1;
+    }
+    if (bytes > CLASES * GRANULO || alineacion > GRANULO) {
+        return superior->allocate(bytes, alineacion);
+    }
+
+    size_t clase = (bytes - 1) / GRANULO;
+    size_t tamanio = (clase + 1) * GRANULO;
+    bytesEnUso += tamanio;
+
+    if (libres[clase] != nullptr) {
+        Libre* bloque = libres[clase];
+        libres[clase] = bloque->siguiente;
+        return bloque;
+    }
+
+    if (static_cast<size_t>(limite - cursor) < tamanio) {
+        // El resto de la página anterior (menos de 256 bytes) se descarta
+        paginas.push_back(superior->allocate(TAMANIO_PAGINA, GRANULO));
+        cursor = static_cast<char*>(paginas.back());
+        limite = cursor + TAMANIO_PAGINA;
+    }
+    void* bloque = cursor;
+    cursor += tamanio;
+    return bloque;
+}
+
+void PoolNodos::do_deallocate(void* puntero, size_t bytes, size_t alineacion) {
+    if (bytes == 0) {
+        bytes = 1;
+    }
+    if (bytes > CLASES * GRANULO || alineacion > GRANULO) {
+        superior->deallocate(puntero, bytes, alineacion);
+        return;
+    }
+
+    size_t clase = (bytes - 1) / GRANULO;
+    bytesEnUso -= (clase + 1) * GRANULO;
+    Libre* bloque = static_cast<Libre*>(puntero);
+    bloque->siguiente = libres[clase];
+    libres[clase] = bloque;
+}
+
+bool PoolNodos::do_is_equal(const std::pmr::memory_resource& otro) const noexcept {
+    return this == &otro;
+}
+
+void PoolNodos::liberar() {
+    for (void* pagina : paginas) {
+        superior->deallocate(pagina, TAMANIO_PAGINA, GRANULO);
+    }
+    paginas.clear();
+    for (Libre*& lista : libres) {
+        lista = nullptr;
+    }
+    cursor = nullptr;
+    limite = nullptr;
+    bytesEnUso = 0;
+}
@@ -0,0 +1,52 @@
+#ifndef POOL_NODOS_H
+#define POOL_NODOS_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+// Clase PoolNodos - Recurso de memoria para nodos de tamaño fijo (std::pmr)
+// Los bloques de hasta 256 bytes se agrupan en clases de 16 bytes; cada clase
+// tiene su lista de libres y los bloques nuevos se toman de páginas de 64 KB.
+// Liberar un nodo lo devuelve a la lista de su clase en O(1) para reutilizarlo;
+// las páginas solo vuelven al recurso superior en liberar() o al destruir el pool.
+// Los pedidos más grandes o con más alineación pasan directo al recurso superior.
+// No es seguro para varios hilos (como los contenedores que lo usan).
+class PoolNodos : public std::pmr::memory_resource {
+private:
+    static constexpr size_t TAMANIO_PAGINA = 1 << 16;
+    static constexpr size_t GRANULO = 16;
+    static constexpr size_t CLASES = 16; // Bloques de 16 a 256 bytes
+
+    struct Libre {
+        Libre* siguiente;
+    };
+
+    std::pmr::memory_resource* superior;
+    std::vector<void*> paginas;
+    Libre* libres[CLASES];
+    char* cursor;  // Próximo byte sin usar de la página actual
+    char* limite;  // Fin de la página actual
+    size_t bytesEnUso;
+
+    void* do_allocate(size_t bytes, size_t alineacion) override;
+    void do_deallocate(void* puntero, size_t bytes, size_t alineacion) override;
+    bool do_is_equal(const std::pmr::memory_resource& otro) const noexcept override;
+
+public:
+    explicit PoolNodos(std::pmr::memory_resource* superior = std::pmr::new_delete_resource());
+    ~PoolNodos() override;
+
+    PoolNodos(const PoolNodos&) = delete;
+    PoolNodos& operator=(const PoolNodos&) = delete;
+
+    // Devolver todas las páginas de una vez. Solo si ya no hay nodos en uso
+    // (por ejemplo tras vaciar los contenedores que usan el pool).
+    void liberar();
+
+    size_t obtenerCantidadPaginas() const { return paginas.size(); }
+    size_t obtenerBytesReservados() const { return paginas.size() * TAMANIO_PAGINA; }
+    size_t obtenerBytesEnUso() const { return bytesEnUso; }
+};
+
+#endif // POOL_NODOS_H
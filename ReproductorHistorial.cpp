@@ -0,0 +1,151 @@
+/**
+ * @file ReproductorHistorial.cpp
+ * @brief Implementación del reproductor de historiales.
+ */
+
+#include "ReproductorHistorial.h"
+#include <algorithm>
+#include <stdexcept>
+
+ReproductorHistorial::ReproductorHistorial(const HistorialMovimientos &historial, int intervalo)
+    : intervalo(std::max(1, intervalo)), posicion(0), partida(0), tablero{}, izquierda(CENTRO), derecha(CENTRO) {
+  codigos.reserve(historial.contador);
+  for (const HistorialMovimientos::Bloque *bloque = historial.cabeza; bloque != nullptr; bloque = bloque->siguiente) {
+    for (int i = 0; i < HistorialMovimientos::JUGADAS_POR_BLOQUE && obtenerCantidad() < historial.contador; ++i) {
+      codigos.push_back(bloque->jugadas[i]);
+    }
+  }
+  for (int j = 0; j < MAXIMO_JUGADORES; ++j) {
+    nombres.push_back(historial.nombreJugador(j));
+  }
+
+  // Una pasada aplicando todas las jugadas: valida y guarda los puntos de control
+  uint32_t enPartida = 0;
+  for (int k = 0; k <= obtenerCantidad(); ++k) {
+    if (k % this->intervalo == 0) {
+      puntos.push_back(PuntoControl{static_cast<uint32_t>(fichasGuardadas.size()), static_cast<uint32_t>(partida),
+                                    static_cast<uint8_t>(cantidadEnTablero())});
+      fichasGuardadas.insert(fichasGuardadas.end(), tablero + izquierda, tablero + derecha);
+    }
+    if (k == obtenerCantidad()) {
+      break;
+    }
+    uint16_t codigo = codigos[k];
+    if (HistorialMovimientos::abreTablero(codigo)) {
+      enPartida = 0;
+    } else if (k == 0) {
+      throw std::invalid_argument("La primera jugada del historial no abre el tablero");
+    }
+    uint32_t ficha = 1u << HistorialMovimientos::decodificar(codigo).ficha;
+    if (enPartida & ficha) {
+      throw std::invalid_argument("Ficha repetida en una partida del historial (jugada " + std::to_string(k + 1) +
+                                  ")");
+    }
+    enPartida |= ficha;
+    aplicar(codigo);
+  }
+  cargarPunto(0);
+}
+
+void ReproductorHistorial::aplicar(uint16_t codigo) {
+  Jugada jugada = HistorialMovimientos::decodificar(codigo);
+  if (HistorialMovimientos::abreTablero(codigo)) {
+    izquierda = derecha = CENTRO;
+    partida++;
+  }
+  uint8_t ficha = static_cast<uint8_t>(jugada.ficha | jugada.volteada << 5);
+  if (jugada.lado == Lado::Izquierda) {
+    tablero[--izquierda] = ficha;
+  } else {
+    tablero[derecha++] = ficha;
+  }
+  posicion++;
+}
+
+// Las fichas guardadas quedan terminando en el centro: en esa partida caben
+// a lo sumo 28 - cantidad fichas más, por cualquiera de los dos lados
+void ReproductorHistorial::cargarPunto(int indice) {
+  const PuntoControl &punto = puntos[indice];
+  izquierda = CENTRO - punto.cantidad;
+  derecha = CENTRO;
+  std::copy_n(fichasGuardadas.begin() + punto.inicioFichas, punto.cantidad, tablero + izquierda);
+  partida = static_cast<int>(punto.partida);
+  posicion = indice * intervalo;
+}
+
+bool ReproductorHistorial::avanzar() {
+  if (posicion == obtenerCantidad()) {
+    return false;
+  }
+  aplicar(codigos[posicion]);
+  return true;
+}
+
+bool ReproductorHistorial::retroceder() {
+  if (posicion == 0) {
+    return false;
+  }
+  uint16_t codigo = codigos[posicion - 1];
+  if (HistorialMovimientos::abreTablero(codigo)) {
+    irA(posicion - 1); // Vuelve al tablero final de la partida anterior
+  } else {
+    if (HistorialMovimientos::decodificar(codigo).lado == Lado::Izquierda) {
+      izquierda++;
+    } else {
+      derecha--;
+    }
+    posicion--;
+  }
+  return true;
+}
+
+void ReproductorHistorial::irA(int nuevaPosicion) {
+  if (nuevaPosicion < 0 || nuevaPosicion > obtenerCantidad()) {
+    throw std::out_of_range("Posición fuera del historial: " + std::to_string(nuevaPosicion));
+  }
+  // Si está un poco más adelante conviene seguir desde la posición actual
+  if (nuevaPosicion < posicion || nuevaPosicion - posicion >= intervalo) {
+    cargarPunto(nuevaPosicion / intervalo);
+  }
+  while (posicion < nuevaPosicion) {
+    aplicar(codigos[posicion]);
+  }
+}
+
+Jugada ReproductorHistorial::ultimaJugada() const {
+  if (posicion == 0) {
+    throw std::out_of_range("Todavía no hay jugadas aplicadas");
+  }
+  return HistorialMovimientos::decodificar(codigos[posicion - 1]);
+}
+
+int ReproductorHistorial::obtenerExtremoIzquierdo() const {
+  if (izquierda == derecha) {
+    return -1;
+  }
+  uint8_t ficha = tablero[izquierda];
+  return (ficha >> 5) ? PIP_MAYOR[ficha & 31] : PIP_MENOR[ficha & 31];
+}
+
+int ReproductorHistorial::obtenerExtremoDerecho() const {
+  if (izquierda == derecha) {
+    return -1;
+  }
+  uint8_t ficha = tablero[derecha - 1];
+  return (ficha >> 5) ? PIP_MENOR[ficha & 31] : PIP_MAYOR[ficha & 31];
+}
+
+std::string ReproductorHistorial::estadoTablero() const {
+  if (izquierda == derecha) {
+    return "[VACÍO]";
+  }
+  std::string resultado;
+  for (int i = izquierda; i < derecha; ++i) {
+    resultado += textoFicha(tablero[i] & 31, tablero[i] >> 5);
+  }
+  return resultado;
+}
+
+size_t ReproductorHistorial::bytesPuntosControl() const {
+  return puntos.size() * sizeof(PuntoControl) + fichasGuardadas.size();
+}
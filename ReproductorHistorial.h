@@ -0,0 +1,83 @@
+/**
+ * @file ReproductorHistorial.h
+ * @brief Reproducción de un historial de dominó: avanzar, retroceder e ir a una jugada.
+ */
+
+#ifndef REPRODUCTOR_HISTORIAL_H
+#define REPRODUCTOR_HISTORIAL_H
+
+#include "HistorialMovimientos.h"
+#include <string>
+#include <vector>
+
+/**
+ * @class ReproductorHistorial
+ * @brief Recorre las jugadas de un historial mostrando el tablero en cada una.
+ *
+ * La posición es la cantidad de jugadas aplicadas (0: antes de la primera).
+ * El reproductor copia los códigos de 2 bytes del historial y guarda un punto
+ * de control cada `intervalo` jugadas con las fichas del tablero en ese
+ * momento (1 byte por ficha). Ir a la posición k carga el punto de control
+ * anterior y aplica a lo sumo intervalo - 1 jugadas, así que cuesta O(intervalo)
+ * y no O(k). Avanzar es O(1), y retroceder también salvo al volver de la
+ * primera jugada de una partida a la partida anterior, que es un salto.
+ *
+ * El tablero se guarda en un arreglo centrado: cada partida tiene a lo sumo
+ * 28 fichas, así que hay lugar para agregar por cualquiera de los dos lados.
+ */
+class ReproductorHistorial {
+private:
+  struct PuntoControl {
+    uint32_t inicioFichas; // Índice en fichasGuardadas
+    uint32_t partida;
+    uint8_t cantidad;
+  };
+
+  static constexpr int CENTRO = CANTIDAD_FICHAS;
+
+  std::vector<uint16_t> codigos;
+  std::vector<std::string> nombres;
+  int intervalo;
+  std::vector<PuntoControl> puntos;
+  std::vector<uint8_t> fichasGuardadas; // Ficha en los bits 0-4, volteada en el bit 5
+
+  // Estado actual
+  int posicion;
+  int partida; // Número de partida de la última jugada aplicada (0 al principio)
+  uint8_t tablero[2 * CANTIDAD_FICHAS + 1];
+  int izquierda; // Tablero en [izquierda, derecha)
+  int derecha;
+
+  void aplicar(uint16_t codigo);
+  void cargarPunto(int indice);
+
+public:
+  /// Lanza std::invalid_argument si el historial repite una ficha en una partida
+  explicit ReproductorHistorial(const HistorialMovimientos &historial, int intervalo = 16);
+
+  int obtenerCantidad() const { return static_cast<int>(codigos.size()); }
+  int obtenerPosicion() const { return posicion; }
+  int obtenerPartida() const { return partida; }
+
+  /// Devuelven false si ya estaba al final o al principio
+  bool avanzar();
+  bool retroceder();
+
+  /// Posición entre 0 y obtenerCantidad(); lanza std::out_of_range si no
+  void irA(int nuevaPosicion);
+
+  /// La jugada que llevó a la posición actual (posición > 0)
+  Jugada ultimaJugada() const;
+  const std::string &nombreJugador(int jugador) const { return nombres[jugador]; }
+
+  int cantidadEnTablero() const { return derecha - izquierda; }
+  /// Extremos del tablero, -1 si está vacío
+  int obtenerExtremoIzquierdo() const;
+  int obtenerExtremoDerecho() const;
+  /// Como en el archivo de historial, o "[VACÍO]"
+  std::string estadoTablero() const;
+
+  size_t bytesPuntosControl() const;
+};
+
+#endif // REPRODUCTOR_HISTORIAL_H
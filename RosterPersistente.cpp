@@ -0,0 +1,405 @@
+#include "RosterPersistente.h"
+#include "ArchivoRoster.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define ROSTER_PERSISTENTE_POSIX 1
+#endif
+
+namespace {
+
+const char MAGICO_LOG[8] = {'R', 'O', 'S', 'T', 'W', 'A', 'L', '1'};
+const char MAGICO_INSTANTANEA[8] = {'R', 'O', 'S', 'T', 'S', 'N', 'P', '1'};
+const uint8_t TIPO_INSERTAR = 1;
+const uint8_t TIPO_ELIMINAR = 2;
+
+// CRC-32 (polinomio 0xEDB88320) con tabla de 256 entradas
+struct TablaCRC {
+    uint32_t valores[256];
+    TablaCRC() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            valores[i] = c;
+        }
+    }
+};
+
+uint32_t calcularCRC(const char* datos, size_t tamanio) {
+    static const TablaCRC tabla;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < tamanio; i++) {
+        crc = tabla.valores[(crc ^ static_cast<unsigned char>(datos[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+template <typename T>
+T leerValor(const char* origen) {
+    T valor;
+    std::memcpy(&valor, origen, sizeof(T));
+    return valor;
+}
+
+template <typename T>
+void escribirValor(std::string& destino, T valor) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &valor, sizeof(T));
+    destino.append(bytes, sizeof(T));
+}
+
+bool existeArchivo(const std::string& ruta) {
+    std::ifstream archivo(ruta, std::ios::binary);
+    return archivo.good();
+}
+
+// Vaciar el búfer de stdio y, si se pide, forzar los datos al disco
+bool sincronizarArchivo(std::FILE* archivo, bool sincronizar) {
+    if (std::fflush(archivo) != 0) {
+        return false;
+    }
+#ifdef ROSTER_PERSISTENTE_POSIX
+    if (sincronizar && ::fsync(::fileno(archivo)) != 0) {
+        return false;
+    }
+#else
+    (void)sincronizar;
+#endif
+    return true;
+}
+
+// Hacer durable la creación o el rename de un archivo en su directorio
+void sincronizarDirectorio(const std::string& ruta, bool sincronizar) {
+#ifdef ROSTER_PERSISTENTE_POSIX
+    if (!sincronizar) {
+        return;
+    }
+    size_t barra = ruta.rfind('/');
+    std::string directorio = barra == std::string::npos ? "." : (barra == 0 ? "/" : ruta.substr(0, barra));
+    int descriptor = ::open(directorio.c_str(), O_RDONLY);
+    if (descriptor >= 0) {
+        ::fsync(descriptor);
+        ::close(descriptor);
+    }
+#else
+    (void)ruta;
+    (void)sincronizar;
+#endif
+}
+
+// Escribir un archivo completo y sincronizarlo
+void escribirArchivo(const std::string& ruta, const std::string& contenido, bool sincronizar) {
+    std::FILE* archivo = std::fopen(ruta.c_str(), "wb");
+    if (archivo == nullptr) {
+        throw std::runtime_error("No se pudo abrir el archivo " + ruta);
+    }
+    bool correcto = std::fwrite(contenido.data(), 1, contenido.size(), archivo) == contenido.size() &&
+                    sincronizarArchivo(archivo, sincronizar);
+    correcto = std::fclose(archivo) == 0 && correcto;
+    if (!correcto) {
+        throw std::runtime_error("Error al escribir el archivo " + ruta);
+    }
+}
+
+} // namespace
+
+// Constructor - recupera el estado y arranca el hilo escritor
+RosterPersistente::RosterPersistente(const std::string& base, OpcionesPersistencia opciones)
+    : rutaLog(base + ".wal"), rutaInstantanea(base + ".snapshot"), opciones(opciones),
+      ultimaSecuencia(0), secuenciaDuradera(0), detener(false), log(nullptr), bytesLog(0),
+      umbralInstantanea(opciones.bytesParaInstantanea) {
+    recuperar();
+    escritor = std::thread(&RosterPersistente::cicloEscritor, this);
+}
+
+// Destructor - el hilo escritor vacía los pendientes antes de terminar
+RosterPersistente::~RosterPersistente() {
+    {
+        std::lock_guard<std::mutex> bloqueo(mutexLista);
+        detener = true;
+    }
+    hayPendientes.notify_one();
+    escritor.join();
+    if (log != nullptr) {
+        std::fclose(log);
+    }
+}
+
+// Cargar la instantánea (mmap) y aplicar la cola del log
+void RosterPersistente::recuperar() {
+    uint64_t secuenciaInstantanea = 0;
+
+    if (existeArchivo(rutaInstantanea)) {
+        ArchivoMapeado archivo(rutaInstantanea);
+        const char* datos = archivo.obtenerDatos();
+        if (archivo.obtenerTamanio() < 16 || std::memcmp(datos, MAGICO_INSTANTANEA, 8) != 0) {
+            throw std::runtime_error("Instantánea dañada: " + rutaInstantanea);
+        }
+        secuenciaInstantanea = leerValor<uint64_t>(datos + 8);
+        lista.insertarLote(interpretarRosterBinario(datos + 16, archivo.obtenerTamanio() - 16));
+    }
+    ultimaSecuencia = secuenciaInstantanea;
+
+    std::string prefijoValido;
+    bool colaRota = false;
+    if (existeArchivo(rutaLog)) {
+        ArchivoMapeado archivo(rutaLog);
+        const char* datos = archivo.obtenerDatos();
+        size_t tamanio = archivo.obtenerTamanio();
+
+        if (tamanio >= 8 && std::memcmp(datos, MAGICO_LOG, 8) != 0) {
+            throw std::runtime_error("Log dañado: " + rutaLog);
+        }
+
+        size_t posicion = 8;
+        while (tamanio >= 8 && tamanio - posicion >= 8) {
+            uint32_t largo = leerValor<uint32_t>(datos + posicion);
+            uint32_t crc = leerValor<uint32_t>(datos + posicion + 4);
+            const char* cuerpo = datos + posicion + 8;
+            if (largo < 9 || largo > tamanio - posicion - 8 || calcularCRC(cuerpo, largo) != crc) {
+                break; // Escritura interrumpida: lo que sigue no es válido
+            }
+
+            uint64_t secuencia = leerValor<uint64_t>(cuerpo);
+            uint8_t tipo = static_cast<uint8_t>(cuerpo[8]);
+            const char* carga = cuerpo + 9;
+            size_t largoCarga = largo - 9;
+
+            if (secuencia > secuenciaInstantanea) {
+                aplicarRegistro(tipo, carga, largoCarga);
+                ultimaSecuencia = std::max(ultimaSecuencia, secuencia);
+            }
+            posicion += 8 + largo;
+        }
+
+        if (tamanio >= 8 && posicion != tamanio) {
+            colaRota = true;
+            prefijoValido.assign(datos, posicion);
+        } else if (tamanio < 8) {
+            colaRota = true; // Log creado a medias: se vuelve a crear vacío
+        }
+    } else {
+        colaRota = true;
+    }
+
+    secuenciaDuradera = ultimaSecuencia;
+
+    // Dejar en el log solo la parte válida, así lo nuevo no queda detrás de basura
+    if (colaRota) {
+        if (prefijoValido.empty()) {
+            prefijoValido.assign(MAGICO_LOG, 8);
+        }
+        escribirArchivo(rutaLog, prefijoValido, opciones.sincronizar);
+        sincronizarDirectorio(rutaLog, opciones.sincronizar);
+    }
+    abrirLog(false);
+}
+
+// Aplicar a la lista un registro del log; devuelve si hubo cambio
+bool RosterPersistente::aplicarRegistro(uint8_t tipo, const char* carga, size_t largoCarga) {
+    if (tipo == TIPO_INSERTAR) {
+        Estudiante estudiante;
+        if (decodificarEstudiante(carga, largoCarga, estudiante) != largoCarga) {
+            throw std::runtime_error("Registro de inserción inválido en " + rutaLog);
+        }
+        lista.insertar(std::move(estudiante));
+        return true;
+    }
+    if (tipo == TIPO_ELIMINAR && largoCarga >= 4 && leerValor<uint32_t>(carga) == largoCarga - 4) {
+        return lista.eliminar(std::string(carga + 4, largoCarga - 4));
+    }
+    throw std::runtime_error("Registro desconocido en " + rutaLog);
+}
+
+// Abrir el log para agregar; con 'vaciar' se deja solo la cabecera
+void RosterPersistente::abrirLog(bool vaciar) {
+    if (log != nullptr) {
+        std::fclose(log);
+        log = nullptr;
+    }
+    if (vaciar) {
+        escribirArchivo(rutaLog, std::string(MAGICO_LOG, 8), opciones.sincronizar);
+    }
+
+    log = std::fopen(rutaLog.c_str(), "ab");
+    if (log == nullptr) {
+        throw std::runtime_error("No se pudo abrir el log " + rutaLog);
+    }
+    std::fseek(log, 0, SEEK_END);
+    bytesLog = static_cast<size_t>(std::ftell(log));
+}
+
+// Commit en grupo: todo lo pendiente se escribe con un solo write + fsync y
+// recién entonces se aplica a la lista, en orden de secuencia
+void RosterPersistente::cicloEscritor() {
+    std::unique_lock<std::mutex> bloqueo(mutexLista);
+    while (true) {
+        hayPendientes.wait(bloqueo, [this]() { return !pendientes.empty() || detener; });
+        if (pendientes.empty()) {
+            break; // Detener sin nada pendiente
+        }
+
+        std::vector<Pendiente> lote;
+        lote.swap(pendientes);
+        uint64_t hasta = ultimaSecuencia;
+        bloqueo.unlock();
+
+        std::string falla;
+        {
+            std::lock_guard<std::mutex> bloqueoLog(mutexLog);
+            std::string bufer;
+            for (const Pendiente& pendiente : lote) {
+                bufer += pendiente.registro;
+            }
+            bool escrito = log != nullptr &&
+                           std::fwrite(bufer.data(), 1, bufer.size(), log) == bufer.size() &&
+                           sincronizarArchivo(log, opciones.sincronizar);
+            if (!escrito) {
+                falla = "Error al escribir el log " + rutaLog;
+            } else {
+                bytesLog += bufer.size();
+
+                bloqueo.lock();
+                for (const Pendiente& pendiente : lote) {
+                    const std::string& registro = pendiente.registro;
+                    bool cambio = aplicarRegistro(static_cast<uint8_t>(registro[16]), registro.data() + 17,
+                                                  registro.size() - 17);
+                    if (pendiente.cambio != nullptr) {
+                        *pendiente.cambio = cambio;
+                    }
+                }
+                secuenciaDuradera = hasta;
+                hayCommit.notify_all();
+                bloqueo.unlock();
+
+                // Una instantánea fallida no afecta al lote, que ya es durable en el
+                // log: se avisa y se reintenta al llegar al siguiente umbral
+                if (bytesLog > umbralInstantanea) {
+                    try {
+                        escribirInstantanea();
+                        umbralInstantanea = opciones.bytesParaInstantanea;
+                    } catch (const std::exception& e) {
+                        std::cerr << "Error: " << e.what() << std::endl;
+                        umbralInstantanea = bytesLog + opciones.bytesParaInstantanea;
+                        if (log == nullptr) {
+                            falla = "No se pudo reabrir el log " + rutaLog;
+                        }
+                    }
+                }
+            }
+        }
+
+        bloqueo.lock();
+        if (!falla.empty() && error.empty()) {
+            error = falla;
+        }
+        hayCommit.notify_all();
+    }
+}
+
+// Instantánea: serializar bajo el mutex de la lista, escribir un temporal,
+// renombrarlo y vaciar el log. La lista tiene aplicado exactamente hasta
+// secuenciaDuradera; lo pendiente lleva secuencias mayores y va al log nuevo.
+void RosterPersistente::escribirInstantanea() {
+    std::string contenido(MAGICO_INSTANTANEA, 8);
+    {
+        std::lock_guard<std::mutex> bloqueo(mutexLista);
+        escribirValor<uint64_t>(contenido, secuenciaDuradera);
+        contenido += serializarRosterBinario(lista);
+    }
+
+    std::string temporal = rutaInstantanea + ".tmp";
+    escribirArchivo(temporal, contenido, opciones.sincronizar);
+#ifndef ROSTER_PERSISTENTE_POSIX
+    std::remove(rutaInstantanea.c_str()); // rename no reemplaza fuera de POSIX
+#endif
+    if (std::rename(temporal.c_str(), rutaInstantanea.c_str()) != 0) {
+        throw std::runtime_error("No se pudo renombrar la instantánea " + temporal);
+    }
+    sincronizarDirectorio(rutaInstantanea, opciones.sincronizar);
+
+    abrirLog(true);
+}
+
+void RosterPersistente::registrarYEsperar(std::unique_lock<std::mutex>& bloqueo, uint8_t tipo,
+                                          const std::string& datos, bool* cambio) {
+    uint64_t secuencia = ++ultimaSecuencia;
+
+    std::string registro;
+    registro.reserve(8 + 9 + datos.size());
+    escribirValor<uint32_t>(registro, static_cast<uint32_t>(9 + datos.size()));
+    escribirValor<uint32_t>(registro, 0);
+    escribirValor<uint64_t>(registro, secuencia);
+    registro.push_back(static_cast<char>(tipo));
+    registro += datos;
+    uint32_t crc = calcularCRC(registro.data() + 8, registro.size() - 8);
+    std::memcpy(&registro[4], &crc, sizeof(crc));
+
+    pendientes.push_back(Pendiente{std::move(registro), cambio});
+    hayPendientes.notify_one();
+    hayCommit.wait(bloqueo, [&]() { return secuenciaDuradera >= secuencia || !error.empty(); });
+    if (secuenciaDuradera < secuencia) {
+        throw std::runtime_error(error);
+    }
+}
+
+void RosterPersistente::insertar(const Estudiante& estudiante) {
+    std::string datos;
+    codificarEstudiante(datos, estudiante);
+
+    std::unique_lock<std::mutex> bloqueo(mutexLista);
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+    registrarYEsperar(bloqueo, TIPO_INSERTAR, datos, nullptr);
+}
+
+bool RosterPersistente::eliminar(const std::string& numeroIdentificacion) {
+    std::string datos;
+    escribirValor<uint32_t>(datos, static_cast<uint32_t>(numeroIdentificacion.size()));
+    datos += numeroIdentificacion;
+
+    std::unique_lock<std::mutex> bloqueo(mutexLista);
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+    if (ultimaSecuencia == secuenciaDuradera && lista.buscar(numeroIdentificacion) == -1) {
+        return false; // Sin cambios en curso ni ID presente: nada que registrar
+    }
+    bool cambio = false;
+    registrarYEsperar(bloqueo, TIPO_ELIMINAR, datos, &cambio);
+    return cambio;
+}
+
+void RosterPersistente::tomarInstantanea() {
+    std::lock_guard<std::mutex> bloqueoLog(mutexLog);
+    escribirInstantanea();
+}
+
+int RosterPersistente::buscar(const std::string& numeroIdentificacion) const {
+    std::lock_guard<std::mutex> bloqueo(mutexLista);
+    return lista.buscar(numeroIdentificacion);
+}
+
+int RosterPersistente::obtenerTamanio() const {
+    std::lock_guard<std::mutex> bloqueo(mutexLista);
+    return lista.obtenerTamanio();
+}
+
+uint64_t RosterPersistente::obtenerUltimaSecuencia() const {
+    std::lock_guard<std::mutex> bloqueo(mutexLista);
+    return ultimaSecuencia;
+}
+
+size_t RosterPersistente::obtenerBytesLog() {
+    std::lock_guard<std::mutex> bloqueoLog(mutexLog);
+    return bytesLog;
+}
@@ -0,0 +1,108 @@
+#ifndef ROSTER_PERSISTENTE_H
+#define ROSTER_PERSISTENTE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ListadoEstudiantil.h"
+
+// Opciones de persistencia
+struct OpcionesPersistencia {
+    bool sincronizar = true;                  // fsync en cada grupo (durabilidad real)
+    size_t bytesParaInstantanea = 64u << 20;  // Tamaño del log que dispara una instantánea
+};
+
+// Clase RosterPersistente - ListadoEstudiantil durable con log de escritura anticipada
+// Archivos: <base>.wal (log de cambios) y <base>.snapshot (instantánea compacta).
+//
+// Cada insertar/eliminar recibe un número de secuencia y se agrega al log; la
+// llamada vuelve cuando el registro está en disco. Un hilo escritor junta los
+// registros pendientes de todos los hilos, los escribe con un solo write + fsync
+// (commit en grupo) y solo entonces los aplica a la lista, así un cambio que no
+// llegó al disco nunca se ve en memoria ni entra en una instantánea. Cuando el
+// log supera el umbral se escribe una instantánea (archivo temporal + rename) y
+// el log se vacía; si la instantánea falla se reintenta en el siguiente umbral.
+//
+// Al abrir se proyecta la instantánea con mmap, se aplican los registros del log
+// con secuencia mayor a la de la instantánea y se descarta la cola rota de una
+// escritura interrumpida (cada registro lleva CRC-32).
+//
+// Formato del log: "ROSTWAL1" y luego registros
+//   uint32 largo, uint32 crc, uint64 secuencia, uint8 tipo, datos (largo incluye secuencia..datos)
+//   tipo 1 = insertar (registro del roster binario), 2 = eliminar (uint32 largo + ID)
+// Formato de la instantánea: "ROSTSNP1", uint64 secuencia, roster binario
+class RosterPersistente {
+private:
+    std::string rutaLog;
+    std::string rutaInstantanea;
+    OpcionesPersistencia opciones;
+
+    // Estado protegido por mutexLista
+    mutable std::mutex mutexLista;
+    ListadoEstudiantil lista;
+    uint64_t ultimaSecuencia;      // Última secuencia asignada
+    uint64_t secuenciaDuradera;    // Todo hasta aquí está en disco y aplicado a la lista
+    struct Pendiente {
+        std::string registro;      // Registro completo del log
+        bool* cambio;              // Dónde dejar si eliminar encontró el ID (o nullptr)
+    };
+    std::vector<Pendiente> pendientes;
+    std::string error;             // Primer error del log (vacío si no hubo)
+    bool detener;
+    std::condition_variable hayPendientes;
+    std::condition_variable hayCommit;
+
+    // Archivo del log; solo lo usa quien tiene mutexLog
+    std::mutex mutexLog;
+    std::FILE* log;
+    size_t bytesLog;
+    size_t umbralInstantanea;      // Sube tras una instantánea fallida
+
+    std::thread escritor;
+
+    void recuperar();
+    void abrirLog(bool vaciar);
+    bool aplicarRegistro(uint8_t tipo, const char* carga, size_t largoCarga); // Con mutexLista tomado
+    void cicloEscritor();
+    void escribirInstantanea(); // Requiere mutexLog tomado
+
+    // Registrar un cambio y esperar a que sea durable y esté aplicado (con mutexLista tomado)
+    void registrarYEsperar(std::unique_lock<std::mutex>& bloqueo, uint8_t tipo, const std::string& datos,
+                           bool* cambio);
+
+public:
+    // Abre o crea el roster persistente y recupera su estado.
+    // Lanza std::runtime_error si los archivos no se pueden abrir o están dañados.
+    explicit RosterPersistente(const std::string& base, OpcionesPersistencia opciones = OpcionesPersistencia());
+
+    // Escribe lo pendiente y cierra el log
+    ~RosterPersistente();
+
+    RosterPersistente(const RosterPersistente&) = delete;
+    RosterPersistente& operator=(const RosterPersistente&) = delete;
+
+    // Cambios durables: vuelven cuando el cambio está en el log en disco
+    void insertar(const Estudiante& estudiante);
+    bool eliminar(const std::string& numeroIdentificacion);
+
+    // Escribir una instantánea ahora y vaciar el log
+    void tomarInstantanea();
+
+    // Lectura bajo el mutex de la lista (solo ve cambios durables)
+    template <typename Funcion>
+    auto leer(Funcion funcion) const {
+        std::lock_guard<std::mutex> bloqueo(mutexLista);
+        return funcion(static_cast<const ListadoEstudiantil&>(lista));
+    }
+
+    int buscar(const std::string& numeroIdentificacion) const;
+    int obtenerTamanio() const;
+    uint64_t obtenerUltimaSecuencia() const;
+    size_t obtenerBytesLog();
+};
+
+#endif // ROSTER_PERSISTENTE_H
@@ -0,0 +1,284 @@
+#ifndef SENAL_BIOMEDICA_H
+#define SENAL_BIOMEDICA_H
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include "EstadisticasECG.h"
+
+// Plantilla SeñalBiomedica - Lista doblemente enlazada de muestras multicanal
+// T es el tipo de muestra (double, float, int16_t...) y Canales la cantidad de
+// canales, ambos fijos en compilación: cada configuración se compila por separado
+// y los bucles sobre canales se desenrollan sin decisiones en tiempo de ejecución.
+// Contiene la lógica común (almacenamiento, filtro, picos, estadísticas); las
+// clases derivadas agregan la entrada/salida propia de cada señal (ver SeñalECG).
+template <typename T, std::size_t Canales = 1>
+class SeñalBiomedica {
+    static_assert(std::is_arithmetic<T>::value, "El tipo de muestra debe ser numérico");
+    static_assert(Canales >= 1, "La señal debe tener al menos un canal");
+
+public:
+    using Muestra = std::array<T, Canales>;
+    static constexpr std::size_t CANALES = Canales;
+
+protected:
+    // Nodo de la lista doblemente enlazada
+    struct Nodo {
+        Muestra amplitud;
+        T tiempo;
+        Nodo* anterior;
+        Nodo* siguiente;
+
+        Nodo(const Muestra& amp, T t)
+            : amplitud(amp), tiempo(t), anterior(nullptr), siguiente(nullptr) {}
+    };
+
+    Nodo* cabeza;
+    Nodo* cola;
+    int tamanio;
+
+    // Lista enlazada para la señal filtrada
+    Nodo* cabezaFiltrada;
+    Nodo* colaFiltrada;
+
+    // Métodos auxiliares protegidos
+    static void limpiarLista(Nodo*& cabeza, Nodo*& cola);
+    static void enlazarAlFinal(Nodo*& cabeza, Nodo*& cola, Nodo* nuevoNodo);
+
+    // Interpretar "c1,c2,...,tiempo" sin copias; false si el formato no es válido
+    static bool interpretarLinea(const char* inicio, const char* fin, Muestra& amplitud, T& tiempo);
+
+public:
+    // Constructor
+    SeñalBiomedica();
+
+    // Destructor
+    ~SeñalBiomedica();
+
+    // La lista es dueña de sus nodos: no se copia
+    SeñalBiomedica(const SeñalBiomedica&) = delete;
+    SeñalBiomedica& operator=(const SeñalBiomedica&) = delete;
+
+    // Método para agregar una muestra al final de la señal original
+    void agregarMuestra(const Muestra& amplitud, T tiempo);
+
+    // Método para agregar una muestra y su versión filtrada (filtro en línea)
+    void agregarMuestraFiltrando(const Muestra& amplitud, T tiempo, double alpha);
+
+    // Filtro pasa bajos y[n] = alpha * x[n] + (1 - alpha) * y[n-1] en todos los canales
+    void filtrarPasaBajos(double alpha = 0.1);
+
+    // Método para obtener los índices de los picos de un canal de la señal filtrada
+    std::vector<int> detectarIndicesPicos(T umbral, std::size_t canal = 0) const;
+
+    // Método para obtener los tiempos de los picos de un canal de la señal filtrada
+    std::vector<T> detectarTiemposPicos(T umbral, std::size_t canal = 0) const;
+
+    // Método para copiar las amplitudes de un canal a un arreglo contiguo
+    std::vector<T> obtenerAmplitudes(bool filtrada = false, std::size_t canal = 0) const;
+
+    // Método para calcular estadísticas de un canal en una sola pasada
+    EstadisticasECG calcularEstadisticas(bool filtrada = false, std::size_t canal = 0) const;
+
+    // Métodos auxiliares
+    int obtenerTamanio() const { return tamanio; }
+    bool estaVacia() const { return cabeza == nullptr; }
+    bool estaFiltrada() const { return cabezaFiltrada != nullptr; }
+    T obtenerDuracion() const { return cola != nullptr ? cola->tiempo : T(); }
+};
+
+// ========== IMPLEMENTACIÓN ==========
+
+// Constructor - inicializa listas vacías
+template <typename T, std::size_t Canales>
+SeñalBiomedica<T, Canales>::SeñalBiomedica()
+    : cabeza(nullptr), cola(nullptr), tamanio(0),
+      cabezaFiltrada(nullptr), colaFiltrada(nullptr) {}
+
+// Destructor - libera la memoria asignada dinámicamente
+template <typename T, std::size_t Canales>
+SeñalBiomedica<T, Canales>::~SeñalBiomedica() {
+    limpiarLista(cabeza, cola);
+    limpiarLista(cabezaFiltrada, colaFiltrada);
+}
+
+// Método auxiliar para limpiar una lista
+template <typename T, std::size_t Canales>
+void SeñalBiomedica<T, Canales>::limpiarLista(Nodo*& cabeza, Nodo*& cola) {
+    Nodo* actual = cabeza;
+    while (actual != nullptr) {
+        Nodo* siguiente = actual->siguiente;
+        delete actual;
+        actual = siguiente;
+    }
+    cabeza = nullptr;
+    cola = nullptr;
+}
+
+// Método auxiliar para enlazar un nodo al final de una lista
+template <typename T, std::size_t Canales>
+void SeñalBiomedica<T, Canales>::enlazarAlFinal(Nodo*& cabeza, Nodo*& cola, Nodo* nuevoNodo) {
+    if (cabeza == nullptr) {
+        cabeza = cola = nuevoNodo;
+    } else {
+        cola->siguiente = nuevoNodo;
+        nuevoNodo->anterior = cola;
+        cola = nuevoNodo;
+    }
+}
+
+// Interpretar una línea de texto con Canales amplitudes y el tiempo al final
+template <typename T, std::size_t Canales>
+bool SeñalBiomedica<T, Canales>::interpretarLinea(const char* inicio, const char* fin,
+                                                  Muestra& amplitud, T& tiempo) {
+    auto leerCampo = [](const char* desde, const char* hasta, T& valor) {
+        while (desde < hasta && (*desde == ' ' || *desde == '\t')) desde++;
+        while (hasta > desde && (hasta[-1] == ' ' || hasta[-1] == '\t' || hasta[-1] == '\r')) hasta--;
+        if (desde < hasta && *desde == '+') desde++;
+        return desde < hasta && std::from_chars(desde, hasta, valor).ec == std::errc();
+    };
+
+    for (std::size_t c = 0; c < Canales; c++) {
+        const char* coma = static_cast<const char*>(std::memchr(inicio, ',', fin - inicio));
+        if (coma == nullptr || !leerCampo(inicio, coma, amplitud[c])) {
+            return false;
+        }
+        inicio = coma + 1;
+    }
+    return leerCampo(inicio, fin, tiempo);
+}
+
+// Agregar una muestra al final de la señal original
+template <typename T, std::size_t Canales>
+void SeñalBiomedica<T, Canales>::agregarMuestra(const Muestra& amplitud, T tiempo) {
+    enlazarAlFinal(cabeza, cola, new Nodo(amplitud, tiempo));
+    tamanio++;
+}
+
+// Agregar una muestra y filtrarla de inmediato, continuando desde la última salida
+template <typename T, std::size_t Canales>
+void SeñalBiomedica<T, Canales>::agregarMuestraFiltrando(const Muestra& amplitud, T tiempo, double alpha) {
+    agregarMuestra(amplitud, tiempo);
+
+    Muestra salida = amplitud; // La primera muestra inicializa el filtro
+    if (colaFiltrada != nullptr) {
+        for (std::size_t c = 0; c < Canales; c++) {
+            salida[c] = static_cast<T>(alpha * amplitud[c] + (1.0 - alpha) * colaFiltrada->amplitud[c]);
+        }
+    }
+    enlazarAlFinal(cabezaFiltrada, colaFiltrada, new Nodo(salida, tiempo));
+}
+
+// Filtro digital pasa bajos usando ecuaciones de diferencias (EMA por canal)
+template <typename T, std::size_t Canales>
+void SeñalBiomedica<T, Canales>::filtrarPasaBajos(double alpha) {
+    limpiarLista(cabezaFiltrada, colaFiltrada);
+
+    if (cabeza == nullptr) {
+        return;
+    }
+
+    Muestra yAnterior = cabeza->amplitud; // Inicializar con el primer valor
+    for (Nodo* actual = cabeza; actual != nullptr; actual = actual->siguiente) {
+        Muestra yActual;
+        for (std::size_t c = 0; c < Canales; c++) {
+            yActual[c] = static_cast<T>(alpha * actual->amplitud[c] + (1.0 - alpha) * yAnterior[c]);
+        }
+        enlazarAlFinal(cabezaFiltrada, colaFiltrada, new Nodo(yActual, actual->tiempo));
+        yAnterior = yActual;
+    }
+}
+
+// Detectar máximos locales por encima del umbral y devolver su índice de muestra
+template <typename T, std::size_t Canales>
+std::vector<int> SeñalBiomedica<T, Canales>::detectarIndicesPicos(T umbral, std::size_t canal) const {
+    std::vector<int> indices;
+
+    if (cabezaFiltrada == nullptr || canal >= Canales) {
+        return indices;
+    }
+
+    Nodo* actual = cabezaFiltrada->siguiente; // Empezar desde el segundo nodo
+    int indice = 1;
+
+    while (actual != nullptr && actual->siguiente != nullptr) {
+        if (actual->amplitud[canal] > actual->anterior->amplitud[canal] &&
+            actual->amplitud[canal] > actual->siguiente->amplitud[canal] &&
+            actual->amplitud[canal] > umbral) {
+            indices.push_back(indice);
+        }
+        actual = actual->siguiente;
+        indice++;
+    }
+
+    return indices;
+}
+
+// Igual que detectarIndicesPicos, pero devolviendo el tiempo de cada pico
+template <typename T, std::size_t Canales>
+std::vector<T> SeñalBiomedica<T, Canales>::detectarTiemposPicos(T umbral, std::size_t canal) const {
+    std::vector<T> tiempos;
+
+    if (cabezaFiltrada == nullptr || canal >= Canales) {
+        return tiempos;
+    }
+
+    Nodo* actual = cabezaFiltrada->siguiente;
+
+    while (actual != nullptr && actual->siguiente != nullptr) {
+        if (actual->amplitud[canal] > actual->anterior->amplitud[canal] &&
+            actual->amplitud[canal] > actual->siguiente->amplitud[canal] &&
+            actual->amplitud[canal] > umbral) {
+            tiempos.push_back(actual->tiempo);
+        }
+        actual = actual->siguiente;
+    }
+
+    return tiempos;
+}
+
+// Copiar las amplitudes de un canal a un vector contiguo
+template <typename T, std::size_t Canales>
+std::vector<T> SeñalBiomedica<T, Canales>::obtenerAmplitudes(bool filtrada, std::size_t canal) const {
+    std::vector<T> amplitudes;
+    if (canal >= Canales) {
+        return amplitudes;
+    }
+    amplitudes.reserve(tamanio);
+
+    for (Nodo* actual = filtrada ? cabezaFiltrada : cabeza; actual != nullptr; actual = actual->siguiente) {
+        amplitudes.push_back(actual->amplitud[canal]);
+    }
+
+    return amplitudes;
+}
+
+// Calcular todas las estadísticas recorriendo la lista una sola vez
+// Las amplitudes se copian a un bloque fijo que procesa agregarBloque (AVX2 si existe)
+template <typename T, std::size_t Canales>
+EstadisticasECG SeñalBiomedica<T, Canales>::calcularEstadisticas(bool filtrada, std::size_t canal) const {
+    EstadisticasECG estadisticas;
+    if (canal >= Canales) {
+        return estadisticas;
+    }
+
+    double bloque[EstadisticasECG::TAMANIO_BLOQUE];
+    std::size_t n = 0;
+
+    for (Nodo* actual = filtrada ? cabezaFiltrada : cabeza; actual != nullptr; actual = actual->siguiente) {
+        bloque[n++] = static_cast<double>(actual->amplitud[canal]);
+        if (n == EstadisticasECG::TAMANIO_BLOQUE) {
+            estadisticas.agregarBloque(bloque, n);
+            n = 0;
+        }
+    }
+    estadisticas.agregarBloque(bloque, n);
+
+    return estadisticas;
+}
+
+#endif // SENAL_BIOMEDICA_H
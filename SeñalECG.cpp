@@ -5,29 +5,10 @@
 #include <cmath>
 #include <algorithm>
 #include <iomanip>
-
-// Constructor - inicializa listas vacías
-SeñalECG::SeñalECG() 
-    : cabeza(nullptr), cola(nullptr), tamanio(0),
-      cabezaFiltrada(nullptr), colaFiltrada(nullptr) {}
-
-// Destructor - libera la memoria asignada dinámicamente
-SeñalECG::~SeñalECG() {
-    limpiarLista(cabeza, cola);
-    limpiarLista(cabezaFiltrada, colaFiltrada);
-}
-
-// Método auxiliar para limpiar una lista
-void SeñalECG::limpiarLista(Nodo*& cabeza, Nodo*& cola) {
-    Nodo* actual = cabeza;
-    while (actual != nullptr) {
-        Nodo* siguiente = actual->siguiente;
-        delete actual;
-        actual = siguiente;
-    }
-    cabeza = nullptr;
-    cola = nullptr;
-}
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
 
 // Cargar la señal desde el archivo de texto
 bool SeñalECG::cargarDesdeArchivo(const std::string& nombreArchivo) {
@@ -67,17 +48,7 @@ bool SeñalECG::cargarDesdeArchivo(const std::string& nombreArchivo) {
                 double tiempo = std::stod(tiempoStr);
                 
                 // Crear nuevo nodo e insertar al final
-                Nodo* nuevoNodo = new Nodo(amplitud, tiempo);
-                
-                if (cabeza == nullptr) {
-                    cabeza = cola = nuevoNodo;
-                } else {
-                    cola->siguiente = nuevoNodo;
-                    nuevoNodo->anterior = cola;
-                    cola = nuevoNodo;
-                }
-                
-                tamanio++;
+                agregarMuestra({amplitud}, tiempo);
             } catch (const std::exception& e) {
                 std::cerr << "Error al procesar línea: " << linea << std::endl;
             }
@@ -89,68 +60,192 @@ bool SeñalECG::cargarDesdeArchivo(const std::string& nombreArchivo) {
     return true;
 }
 
-// Filtro digital pasa bajos usando ecuaciones de diferencias
-// Implementación de un filtro de promedio móvil exponencial (EMA)
-// y[n] = alpha * x[n] + (1 - alpha) * y[n-1]
-void SeñalECG::aplicarFiltroPasaBajos(double alpha) {
-    if (cabeza == nullptr) {
-        std::cerr << "Error: No hay señal cargada" << std::endl;
-        return;
+// Cargar la señal con doble búfer
+// El hilo lector llena un búfer mientras el hilo principal interpreta el otro;
+// las líneas partidas entre dos bloques se guardan en 'resto' hasta completarse
+bool SeñalECG::cargarDesdeArchivoAsincrono(const std::string& nombreArchivo, bool filtrarEnLinea,
+                                           double alpha, size_t tamanioBloque) {
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo " << nombreArchivo << std::endl;
+        return false;
     }
     
-    // Limpiar señal filtrada anterior si existe
-    limpiarLista(cabezaFiltrada, colaFiltrada);
+    if (tamanioBloque == 0) {
+        tamanioBloque = 1 << 20;
+    }
     
-    Nodo* actual = cabeza;
-    double yAnterior = actual->amplitud; // Inicializar con el primer valor
+    // La señal filtrada se reconstruye; si ya había muestras cargadas, se filtran primero
+    if (filtrarEnLinea) {
+        filtrarPasaBajos(alpha);
+    }
     
-    while (actual != nullptr) {
-        // Aplicar ecuación de diferencias del filtro
-        double yActual = alpha * actual->amplitud + (1.0 - alpha) * yAnterior;
-        
-        // Crear nuevo nodo para la señal filtrada
-        Nodo* nuevoNodo = new Nodo(yActual, actual->tiempo);
+    // Estado compartido entre el lector y el intérprete
+    struct Bufer {
+        std::vector<char> datos;
+        size_t bytes = 0;
+        bool lleno = false;
+        bool ultimo = false;
+    };
+    Bufer bufers[2];
+    bufers[0].datos.resize(tamanioBloque);
+    bufers[1].datos.resize(tamanioBloque);
+    std::mutex mutex;
+    std::condition_variable cambio;
+    bool cancelar = false;
+    
+    std::thread lector([&]() {
+        for (int i = 0; ; i ^= 1) {
+            Bufer& bufer = bufers[i];
+            {
+                std::unique_lock<std::mutex> bloqueo(mutex);
+                cambio.wait(bloqueo, [&]() { return !bufer.lleno || cancelar; });
+                if (cancelar) {
+                    return;
+                }
+            }
+            
+            // La lectura ocurre fuera del candado, en paralelo con la interpretación
+            archivo.read(bufer.datos.data(), static_cast<std::streamsize>(bufer.datos.size()));
+            size_t leidos = static_cast<size_t>(archivo.gcount());
+            bool fin = leidos < bufer.datos.size();
+            
+            {
+                std::lock_guard<std::mutex> bloqueo(mutex);
+                bufer.bytes = leidos;
+                bufer.ultimo = fin;
+                bufer.lleno = true;
+            }
+            cambio.notify_all();
+            
+            if (fin) {
+                return;
+            }
+        }
+    });
+    
+    std::string resto;
+    bool cabeceraLeida = false;
+    bool terminado = false;
+    
+    // Procesa una línea completa; la primera es la cabecera
+    auto procesar = [&](const char* inicio, const char* fin) {
+        if (!cabeceraLeida) {
+            cabeceraLeida = true;
+            return;
+        }
+        // Igual que la carga síncrona: se ignoran líneas vacías o sin separador
+        if (std::find(inicio, fin, ',') == fin) {
+            return;
+        }
         
-        if (cabezaFiltrada == nullptr) {
-            cabezaFiltrada = colaFiltrada = nuevoNodo;
+        Muestra amplitud;
+        double tiempo = 0.0;
+        if (!interpretarLinea(inicio, fin, amplitud, tiempo)) {
+            std::cerr << "Error al procesar línea: " << std::string(inicio, fin) << std::endl;
+        } else if (filtrarEnLinea) {
+            agregarMuestraFiltrando(amplitud, tiempo, alpha);
         } else {
-            colaFiltrada->siguiente = nuevoNodo;
-            nuevoNodo->anterior = colaFiltrada;
-            colaFiltrada = nuevoNodo;
+            agregarMuestra(amplitud, tiempo);
+        }
+    };
+    
+    for (int i = 0; !terminado; i ^= 1) {
+        Bufer& bufer = bufers[i];
+        {
+            std::unique_lock<std::mutex> bloqueo(mutex);
+            cambio.wait(bloqueo, [&]() { return bufer.lleno; });
+        }
+        
+        const char* inicio = bufer.datos.data();
+        const char* fin = inicio + bufer.bytes;
+        const char* linea = inicio;
+        
+        while (linea < fin) {
+            const char* salto = static_cast<const char*>(std::memchr(linea, '\n', fin - linea));
+            if (salto == nullptr) {
+                resto.append(linea, fin);
+                break;
+            }
+            if (!resto.empty()) {
+                resto.append(linea, salto);
+                procesar(resto.data(), resto.data() + resto.size());
+                resto.clear();
+            } else {
+                procesar(linea, salto);
+            }
+            linea = salto + 1;
         }
         
-        yAnterior = yActual;
-        actual = actual->siguiente;
+        terminado = bufer.ultimo;
+        {
+            std::lock_guard<std::mutex> bloqueo(mutex);
+            bufer.lleno = false;
+        }
+        cambio.notify_all();
+    }
+    
+    // Última línea sin salto de línea final
+    if (!resto.empty()) {
+        procesar(resto.data(), resto.data() + resto.size());
+    }
+    
+    {
+        std::lock_guard<std::mutex> bloqueo(mutex);
+        cancelar = true;
+    }
+    cambio.notify_all();
+    lector.join();
+    
+    if (!cabeceraLeida) {
+        std::cerr << "Error: Archivo vacío" << std::endl;
+        return false;
+    }
+    
+    std::cout << "✓ Cargados " << tamanio << " puntos de la señal ECG" << std::endl;
+    if (filtrarEnLinea) {
+        std::cout << "✓ Filtro pasa bajos aplicado durante la carga (alpha = " << alpha << ")" << std::endl;
+    }
+    return true;
+}
+
+// Filtro digital pasa bajos usando ecuaciones de diferencias
+// Implementación de un filtro de promedio móvil exponencial (EMA)
+// y[n] = alpha * x[n] + (1 - alpha) * y[n-1]
+void SeñalECG::aplicarFiltroPasaBajos(double alpha) {
+    if (cabeza == nullptr) {
+        std::cerr << "Error: No hay señal cargada" << std::endl;
+        return;
     }
     
+    filtrarPasaBajos(alpha);
+    
     std::cout << "✓ Filtro pasa bajos aplicado (alpha = " << alpha << ")" << std::endl;
 }
 
 // Detectar picos en la señal filtrada
 std::vector<double> SeñalECG::detectarPicos(double umbral) {
-    std::vector<double> picos;
-    
     if (cabezaFiltrada == nullptr) {
         std::cerr << "Error: Debe aplicar el filtro antes de detectar picos" << std::endl;
-        return picos;
+        return std::vector<double>();
     }
     
-    Nodo* actual = cabezaFiltrada->siguiente; // Empezar desde el segundo nodo
-    
-    while (actual != nullptr && actual->siguiente != nullptr) {
-        // Detectar máximo local
-        if (actual->amplitud > actual->anterior->amplitud &&
-            actual->amplitud > actual->siguiente->amplitud &&
-            actual->amplitud > umbral) {
-            picos.push_back(actual->tiempo);
-        }
-        actual = actual->siguiente;
-    }
+    std::vector<double> picos = detectarTiemposPicos(umbral);
     
     std::cout << "✓ Detectados " << picos.size() << " picos (umbral = " << umbral << ")" << std::endl;
     return picos;
 }
 
+// Segmentar latidos de la señal original usando los picos de la filtrada
+// El filtro retrasa la señal, por eso cada pico se reajusta al máximo original
+// dentro de una vecindad de muestrasAntes muestras
+LatidosECG SeñalECG::extraerLatidos(int muestrasAntes, int muestrasDespues, double umbral) const {
+    LatidosECG latidos(muestrasAntes, muestrasDespues);
+    latidos.extraer(obtenerAmplitudes(false), detectarIndicesPicos(umbral), muestrasAntes);
+    return latidos;
+}
+
 // Imprimir la señal original y filtrada en un archivo
 void SeñalECG::imprimirEnArchivo(const std::string& nombreArchivo) const {
     std::ofstream archivo(nombreArchivo);
@@ -170,10 +265,10 @@ void SeñalECG::imprimirEnArchivo(const std::string& nombreArchivo) const {
     Nodo* filtrada = cabezaFiltrada;
     
     while (original != nullptr) {
-        archivo << original->tiempo << "," << original->amplitud;
+        archivo << original->tiempo << "," << original->amplitud[0];
         
         if (filtrada != nullptr) {
-            archivo << "," << filtrada->amplitud;
+            archivo << "," << filtrada->amplitud[0];
             filtrada = filtrada->siguiente;
         } else {
             archivo << ",";
@@ -229,28 +324,17 @@ void SeñalECG::imprimirEstadisticas() const {
         return;
     }
     
-    // Calcular estadísticas de la señal original
-    double minAmp = cabeza->amplitud;
-    double maxAmp = cabeza->amplitud;
-    double sumaAmp = 0.0;
-    int contador = 0;
-    
-    Nodo* actual = cabeza;
-    while (actual != nullptr) {
-        if (actual->amplitud < minAmp) minAmp = actual->amplitud;
-        if (actual->amplitud > maxAmp) maxAmp = actual->amplitud;
-        sumaAmp += actual->amplitud;
-        contador++;
-        actual = actual->siguiente;
-    }
-    
-    double promedioAmp = sumaAmp / contador;
+    EstadisticasECG estadisticas = calcularEstadisticas();
     
     std::cout << "\n=== ESTADÍSTICAS DE LA SEÑAL ===" << std::endl;
     std::cout << "Puntos totales: " << tamanio << std::endl;
-    std::cout << "Amplitud mínima: " << minAmp << std::endl;
-    std::cout << "Amplitud máxima: " << maxAmp << std::endl;
-    std::cout << "Amplitud promedio: " << promedioAmp << std::endl;
+    std::cout << "Amplitud mínima: " << estadisticas.obtenerMinimo() << std::endl;
+    std::cout << "Amplitud máxima: " << estadisticas.obtenerMaximo() << std::endl;
+    std::cout << "Amplitud promedio: " << estadisticas.obtenerMedia() << std::endl;
+    std::cout << "Desviación estándar: " << estadisticas.obtenerDesviacionEstandar() << std::endl;
+    std::cout << "Mediana (aprox.): " << estadisticas.obtenerMediana() << std::endl;
+    std::cout << "Percentiles 5/95 (aprox.): " << estadisticas.obtenerCuantil(0.05)
+              << " / " << estadisticas.obtenerCuantil(0.95) << std::endl;
     
     if (cabeza != nullptr && cola != nullptr) {
         std::cout << "Duración: " << cola->tiempo << " segundos" << std::endl;
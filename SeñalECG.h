@@ -3,58 +3,42 @@
 
 #include <string>
 #include <vector>
+#include "EstadisticasECG.h"
+#include "LatidosECG.h"
+#include "SeñalBiomedica.h"
 
 // Clase SeñalECG - Lista doblemente enlazada para procesamiento de señales ECG
-class SeñalECG {
-private:
-    // Nodo de la lista doblemente enlazada
-    struct Nodo {
-        double amplitud;
-        double tiempo;
-        Nodo* anterior;
-        Nodo* siguiente;
-        
-        Nodo(double amp, double t) 
-            : amplitud(amp), tiempo(t), anterior(nullptr), siguiente(nullptr) {}
-    };
-    
-    Nodo* cabeza;
-    Nodo* cola;
-    int tamanio;
-    
-    // Lista enlazada para la señal filtrada
-    Nodo* cabezaFiltrada;
-    Nodo* colaFiltrada;
-    
-    // Métodos auxiliares privados
-    void limpiarLista(Nodo*& cabeza, Nodo*& cola);
-    
+// Es la instanciación SeñalBiomedica<double, 1> más la entrada/salida y el
+// análisis propios del ECG (frecuencia cardíaca, latidos)
+class SeñalECG : public SeñalBiomedica<double, 1> {
 public:
     // Constructor
-    SeñalECG();
-    
-    // Destructor
-    ~SeñalECG();
+    SeñalECG() = default;
     
     // Método para cargar la señal desde el archivo de texto
     bool cargarDesdeArchivo(const std::string& nombreArchivo);
     
+    // Método para cargar la señal con doble búfer: un hilo lee el siguiente bloque
+    // del disco mientras se interpreta el actual. Con filtrarEnLinea, el filtro
+    // pasa bajos se aplica a cada bloque apenas se interpreta.
+    bool cargarDesdeArchivoAsincrono(const std::string& nombreArchivo, bool filtrarEnLinea = false,
+                                     double alpha = 0.1, size_t tamanioBloque = 1 << 20);
+    
     // Filtro digital pasa bajos en ecuaciones de diferencias
     void aplicarFiltroPasaBajos(double alpha = 0.1);
     
     // Método para detectar picos en la señal filtrada
     std::vector<double> detectarPicos(double umbral = 50.0);
     
+    // Método para segmentar los latidos alrededor de los picos R detectados
+    LatidosECG extraerLatidos(int muestrasAntes, int muestrasDespues, double umbral = 50.0) const;
+    
     // Método para imprimir la señal original y filtrada en un archivo
     void imprimirEnArchivo(const std::string& nombreArchivo) const;
     
     // Método para calcular la frecuencia cardíaca promedio
     double calcularFrecuenciaCardiaca();
     
-    // Métodos auxiliares
-    int obtenerTamanio() const { return tamanio; }
-    bool estaVacia() const { return cabeza == nullptr; }
-    
     // Método para imprimir estadísticas en consola
     void imprimirEstadisticas() const;
 };
@@ -0,0 +1,244 @@
+/**
+ * @file SolucionadorDomino.cpp
+ * @brief Implementación del solucionador con información perfecta.
+ */
+
+#include "SolucionadorDomino.h"
+#include <algorithm>
+
+namespace {
+
+constexpr int INFINITO = SolucionadorDomino::GANAR + 1;
+
+// Índice de un extremo en zobristExtremos (7: tablero vacío)
+int indiceExtremo(int extremo) { return extremo < 0 ? 7 : extremo; }
+
+// La clave no distingue [a ... b] de [b ... a], así que en la tabla el lado se
+// guarda respecto del extremo menor: se invierte si el izquierdo es el mayor.
+// La misma función convierte en los dos sentidos.
+Lado ladoEnTabla(const EstadoDomino &estado, Lado lado) {
+  if (estado.obtenerExtremoIzquierdo() <= estado.obtenerExtremoDerecho()) {
+    return lado;
+  }
+  return lado == Lado::Izquierda ? Lado::Derecha : Lado::Izquierda;
+}
+
+} // namespace
+
+SolucionadorDomino::SolucionadorDomino(int bitsTabla)
+    : tabla(size_t(1) << std::clamp(bitsTabla, 10, 28)), mascaraTabla(tabla.size() - 1), raiz(0), nodos(0),
+      huboCorte(false), abortado(false), limiteSegundos(0) {
+  GeneradorDomino generador(0x5EED5EED5EEDULL);
+  for (auto &jugador : zobristFicha) {
+    for (uint64_t &clave : jugador) {
+      clave = generador();
+    }
+  }
+  for (auto &fila : zobristExtremos) {
+    for (uint64_t &clave : fila) {
+      clave = generador();
+    }
+  }
+  for (int j = 0; j < MAXIMO_JUGADORES; ++j) {
+    zobristTurno[j] = generador();
+    zobristPases[j] = generador();
+    zobristRaiz[j] = generador();
+  }
+}
+
+void SolucionadorDomino::limpiarTabla() { std::fill(tabla.begin(), tabla.end(), Entrada()); }
+
+uint64_t SolucionadorDomino::claveDeManos(const EstadoDomino &estado) const {
+  uint64_t clave = 0;
+  for (int j = 0; j < estado.obtenerNumJugadores(); ++j) {
+    for (uint32_t resto = estado.obtenerMano(j); resto != 0; resto &= resto - 1) {
+      clave ^= zobristFicha[j][primeraFicha(resto)];
+    }
+  }
+  return clave;
+}
+
+// Los extremos entran sin orden: [a ... b] y [b ... a] se juegan igual
+uint64_t SolucionadorDomino::claveCompleta(const EstadoDomino &estado, uint64_t claveManos) const {
+  int a = indiceExtremo(estado.obtenerExtremoIzquierdo());
+  int b = indiceExtremo(estado.obtenerExtremoDerecho());
+  return claveManos ^ zobristExtremos[std::min(a, b)][std::max(a, b)] ^ zobristTurno[estado.obtenerTurno()] ^
+         zobristPases[estado.obtenerPasesConsecutivos()] ^ zobristRaiz[raiz];
+}
+
+// Estimación para hojas cortadas por profundidad, desde el punto de vista de
+// la raíz: menos fichas que el mejor rival, y menos puntos para una tranca
+int SolucionadorDomino::evaluar(const EstadoDomino &estado) const {
+  int fichasRival = FICHAS_POR_JUGADOR + 1;
+  int puntosRival = 0;
+  for (int j = 0; j < estado.obtenerNumJugadores(); ++j) {
+    if (j != raiz && estado.obtenerTamanioMano(j) < fichasRival) {
+      fichasRival = estado.obtenerTamanioMano(j);
+      puntosRival = estado.sumaPuntosMano(j);
+    }
+  }
+  return 20 * (fichasRival - estado.obtenerTamanioMano(raiz)) + (puntosRival - estado.sumaPuntosMano(raiz)) / 4;
+}
+
+void SolucionadorDomino::ordenar(const EstadoDomino &, ListaMovimientos &lista, Movimiento primero) const {
+  int prioridad[MAXIMO_MOVIMIENTOS];
+  for (int i = 0; i < lista.cantidad; ++i) {
+    const Movimiento &movimiento = lista.movimientos[i];
+    int ficha = movimiento.ficha;
+    prioridad[i] = (movimiento == primero ? 1000 : 0) + (PIP_MENOR[ficha] == PIP_MAYOR[ficha] ? 100 : 0) +
+                   PIP_MENOR[ficha] + PIP_MAYOR[ficha];
+  }
+  // Inserción: a lo sumo 14 movimientos
+  for (int i = 1; i < lista.cantidad; ++i) {
+    Movimiento movimiento = lista.movimientos[i];
+    int valor = prioridad[i];
+    int j = i - 1;
+    while (j >= 0 && prioridad[j] < valor) {
+      lista.movimientos[j + 1] = lista.movimientos[j];
+      prioridad[j + 1] = prioridad[j];
+      --j;
+    }
+    lista.movimientos[j + 1] = movimiento;
+    prioridad[j + 1] = valor;
+  }
+}
+
+int SolucionadorDomino::buscar(const EstadoDomino &estado, uint64_t claveManos, int profundidad, int alfa,
+                               int beta) {
+  if ((++nodos & 4095) == 0 && limiteSegundos > 0 &&
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count() > limiteSegundos) {
+    abortado = true;
+  }
+  if (abortado) {
+    return 0;
+  }
+  if (estado.estaTerminado()) {
+    int valor = GANAR - estado.obtenerCantidadJugadas();
+    return estado.obtenerGanador() == raiz ? valor : -valor;
+  }
+
+  ListaMovimientos lista;
+  estado.movimientosSinSimetricos(lista);
+  if (lista.vacia()) {
+    // Pasar no cuenta como ply para la profundidad: no hay nada que elegir
+    EstadoDomino siguiente = estado;
+    siguiente.pasar();
+    return buscar(siguiente, claveManos, profundidad, alfa, beta);
+  }
+
+  uint64_t clave = claveCompleta(estado, claveManos);
+  Entrada &entrada = tabla[clave & mascaraTabla];
+  Movimiento primero{-1, Lado::Izquierda};
+  if (entrada.clave == clave) {
+    if (entrada.completa || entrada.profundidad >= profundidad) {
+      bool util = entrada.tipo == Exacta || (entrada.tipo == CotaInferior && entrada.valor >= beta) ||
+                  (entrada.tipo == CotaSuperior && entrada.valor <= alfa);
+      if (util) {
+        huboCorte = huboCorte || !entrada.completa;
+        return entrada.valor;
+      }
+    }
+    primero = Movimiento{entrada.ficha, ladoEnTabla(estado, entrada.lado)};
+  }
+
+  if (profundidad == 0) {
+    huboCorte = true;
+    return evaluar(estado);
+  }
+
+  ordenar(estado, lista, primero);
+  bool maximiza = estado.obtenerTurno() == raiz;
+  int jugador = estado.obtenerTurno();
+  int alfaOriginal = alfa;
+  int betaOriginal = beta;
+  int mejorValor = maximiza ? -INFINITO : INFINITO;
+  Movimiento mejor = lista[0];
+  bool cortePrevio = huboCorte;
+  huboCorte = false;
+
+  for (const Movimiento &movimiento : lista) {
+    EstadoDomino siguiente = estado;
+    siguiente.jugar(movimiento);
+    int valor = buscar(siguiente, claveManos ^ zobristFicha[jugador][movimiento.ficha], profundidad - 1, alfa, beta);
+    if (abortado) {
+      return 0;
+    }
+    if (maximiza ? valor > mejorValor : valor < mejorValor) {
+      mejorValor = valor;
+      mejor = movimiento;
+    }
+    if (maximiza) {
+      alfa = std::max(alfa, valor);
+    } else {
+      beta = std::min(beta, valor);
+    }
+    if (alfa >= beta) {
+      break;
+    }
+  }
+
+  bool completa = !huboCorte;
+  huboCorte = cortePrevio || huboCorte;
+
+  // Reemplazo siempre: la entrada más reciente suele ser la más útil
+  Entrada &destino = tabla[clave & mascaraTabla];
+  destino.clave = clave;
+  destino.valor = static_cast<int16_t>(mejorValor);
+  destino.profundidad = static_cast<int8_t>(std::min(profundidad, 127));
+  destino.tipo = mejorValor <= alfaOriginal ? CotaSuperior : mejorValor >= betaOriginal ? CotaInferior : Exacta;
+  destino.completa = completa;
+  destino.ficha = mejor.ficha;
+  destino.lado = ladoEnTabla(estado, mejor.lado);
+  return mejorValor;
+}
+
+ResultadoSolucion SolucionadorDomino::resolver(const EstadoDomino &estado, double limiteSegundos,
+                                               int profundidadMaxima) {
+  ResultadoSolucion resultado;
+  inicio = std::chrono::steady_clock::now();
+  this->limiteSegundos = limiteSegundos;
+  raiz = estado.obtenerTurno();
+  nodos = 0;
+  abortado = false;
+
+  ListaMovimientos lista;
+  estado.movimientosSinSimetricos(lista);
+  resultado.hayMovimiento = !lista.vacia();
+  if (resultado.hayMovimiento) {
+    ordenar(estado, lista, Movimiento{-1, Lado::Izquierda});
+    resultado.mejor = lista[0]; // Por si no alcanza el tiempo ni para la primera iteración
+  }
+
+  uint64_t claveManos = claveDeManos(estado);
+  uint64_t claveRaiz = claveCompleta(estado, claveManos);
+  for (int profundidad = 1; profundidad <= std::min(profundidadMaxima, 127); ++profundidad) {
+    huboCorte = false;
+    int valor = buscar(estado, claveManos, profundidad, -INFINITO, INFINITO);
+    if (abortado) {
+      break;
+    }
+    resultado.valor = valor;
+    resultado.profundidad = profundidad;
+    resultado.exacto = !huboCorte;
+    const Entrada &entrada = tabla[claveRaiz & mascaraTabla];
+    if (resultado.hayMovimiento && entrada.clave == claveRaiz && entrada.ficha >= 0) {
+      resultado.mejor = Movimiento{entrada.ficha, ladoEnTabla(estado, entrada.lado)};
+    }
+    if (resultado.exacto) {
+      break;
+    }
+  }
+
+  resultado.nodos = nodos;
+  resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+  return resultado;
+}
+
+PoliticaSolucionador::PoliticaSolucionador(double segundosPorMovimiento, int bitsTabla)
+    : solucionador(bitsTabla), segundosPorMovimiento(segundosPorMovimiento) {}
+
+Movimiento PoliticaSolucionador::elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                                        GeneradorDomino &) {
+  ResultadoSolucion resultado = solucionador.resolver(estado, segundosPorMovimiento);
+  return resultado.hayMovimiento ? resultado.mejor : legales[0];
+}
@@ -0,0 +1,113 @@
+/**
+ * @file SolucionadorDomino.h
+ * @brief Búsqueda con información perfecta (todas las manos a la vista) para análisis.
+ */
+
+#ifndef SOLUCIONADOR_DOMINO_H
+#define SOLUCIONADOR_DOMINO_H
+
+#include "MotorDomino.h"
+#include <chrono>
+#include <vector>
+
+/**
+ * @struct ResultadoSolucion
+ * @brief Mejor movimiento encontrado y valor de la posición.
+ *
+ * El valor es desde el punto de vista del jugador de turno: si es exacto,
+ * GANAR - j significa que gana con la partida terminando en la jugada j y
+ * -(GANAR - j) que pierde. Si no es exacto es una estimación heurística.
+ */
+struct ResultadoSolucion {
+  bool hayMovimiento = false; // false si el jugador de turno debe pasar o la partida terminó
+  Movimiento mejor{-1, Lado::Izquierda};
+  int valor = 0;
+  bool exacto = false;
+  int profundidad = 0; // Última profundidad completada (en turnos, contando pases)
+  long nodos = 0;
+  double segundos = 0;
+
+  bool ganaSeguro() const { return exacto && valor > 0; }
+};
+
+/**
+ * @class SolucionadorDomino
+ * @brief Alfa-beta con profundización iterativa y tabla de transposición.
+ *
+ * Con 3 o 4 jugadores la búsqueda es paranoica: el jugador de turno supone que
+ * todos los demás juegan en su contra y perder es que gane cualquier otro.
+ *
+ * - Profundización iterativa: profundidad 1, 2, ... hasta que una iteración
+ *   llega al final de todas las líneas (valor exacto) o se agota el tiempo; en
+ *   ese caso queda el resultado de la última iteración completa.
+ * - Tabla de transposición con claves Zobrist (fichas en cada mano, extremos
+ *   sin orden, turno, pases y jugador que analiza). La clave de las manos se
+ *   actualiza con un XOR por jugada.
+ * - Orden de movimientos: primero el mejor de la tabla, luego mulas y fichas de
+ *   más puntos. Si los dos extremos son iguales, jugar a un lado o al otro da
+ *   posiciones simétricas y solo se busca uno.
+ */
+class SolucionadorDomino {
+public:
+  static constexpr int GANAR = 1000;
+
+private:
+  enum TipoEntrada : uint8_t { Exacta, CotaInferior, CotaSuperior };
+
+  struct Entrada {
+    uint64_t clave = 0;
+    int16_t valor = 0;
+    int8_t profundidad = -1;
+    uint8_t tipo = Exacta;
+    bool completa = false; // El subárbol se buscó hasta el final de la partida
+    int8_t ficha = -1;     // Mejor movimiento
+    Lado lado = Lado::Izquierda;
+  };
+
+  std::vector<Entrada> tabla;
+  uint64_t mascaraTabla;
+  uint64_t zobristFicha[MAXIMO_JUGADORES][CANTIDAD_FICHAS];
+  uint64_t zobristExtremos[8][8]; // Índice 7: tablero vacío
+  uint64_t zobristTurno[MAXIMO_JUGADORES];
+  uint64_t zobristPases[MAXIMO_JUGADORES];
+  uint64_t zobristRaiz[MAXIMO_JUGADORES];
+
+  // Estado de la búsqueda en curso
+  int raiz;
+  long nodos;
+  bool huboCorte; // Alguna hoja se evaluó por profundidad y no por final de partida
+  bool abortado;
+  double limiteSegundos;
+  std::chrono::steady_clock::time_point inicio;
+
+  uint64_t claveDeManos(const EstadoDomino &estado) const;
+  uint64_t claveCompleta(const EstadoDomino &estado, uint64_t claveManos) const;
+  int evaluar(const EstadoDomino &estado) const;
+  void ordenar(const EstadoDomino &estado, ListaMovimientos &lista, Movimiento primero) const;
+  int buscar(const EstadoDomino &estado, uint64_t claveManos, int profundidad, int alfa, int beta);
+
+public:
+  /// Tabla de 2^bitsTabla entradas de 16 bytes
+  explicit SolucionadorDomino(int bitsTabla = 20);
+
+  /// Resolver la posición para el jugador de turno. limiteSegundos <= 0: sin límite
+  ResultadoSolucion resolver(const EstadoDomino &estado, double limiteSegundos = 1.0,
+                             int profundidadMaxima = 64);
+
+  void limpiarTabla();
+};
+
+/// Política que ve todas las manos y juega el movimiento del solucionador
+class PoliticaSolucionador : public PoliticaDomino {
+private:
+  SolucionadorDomino solucionador;
+  double segundosPorMovimiento;
+
+public:
+  explicit PoliticaSolucionador(double segundosPorMovimiento = 0.05, int bitsTabla = 18);
+
+  Movimiento elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                    GeneradorDomino &generador) override;
+};
+
+#endif // SOLUCIONADOR_DOMINO_H
@@ -0,0 +1,141 @@
+/**
+ * @file TorneoDomino.cpp
+ * @brief Implementación del torneo Monte Carlo en paralelo.
+ */
+
+#include "TorneoDomino.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+void EstadisticasTorneo::combinar(const EstadisticasTorneo &otras) {
+  participantes = std::max(participantes, otras.participantes);
+  partidas += otras.partidas;
+  trancas += otras.trancas;
+  jugadas += otras.jugadas;
+  pases += otras.pases;
+  for (int i = 0; i < MAXIMO_JUGADORES; ++i) {
+    victoriasAsiento[i] += otras.victoriasAsiento[i];
+    victoriasParticipante[i] += otras.victoriasParticipante[i];
+    for (int j = 0; j < MAXIMO_JUGADORES; ++j) {
+      victoriasParticipanteAsiento[i][j] += otras.victoriasParticipanteAsiento[i][j];
+    }
+  }
+}
+
+double EstadisticasTorneo::tasaAsiento(int asiento) const {
+  return partidas > 0 ? double(victoriasAsiento[asiento]) / partidas : 0.0;
+}
+
+double EstadisticasTorneo::tasaParticipante(int participante) const {
+  return partidas > 0 ? double(victoriasParticipante[participante]) / partidas : 0.0;
+}
+
+double EstadisticasTorneo::margenError(double p) const {
+  return partidas > 0 ? 1.96 * std::sqrt(p * (1.0 - p) / partidas) : 0.0;
+}
+
+void TorneoDomino::agregarParticipante(const std::string &nombre, FabricaPolitica fabrica) {
+  nombres.push_back(nombre);
+  fabricas.push_back(std::move(fabrica));
+}
+
+namespace {
+
+// Estadísticas de un hilo, cada una en su propia línea de caché
+struct alignas(64) EstadisticasHilo {
+  EstadisticasTorneo estadisticas;
+};
+
+// Semilla del lote: splitmix64 de (semilla, lote), para que lotes vecinos no
+// compartan secuencias
+uint64_t semillaDeLote(uint64_t semilla, long lote) {
+  uint64_t z = semilla + 0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(lote + 1);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+} // namespace
+
+EstadisticasTorneo TorneoDomino::jugar(long partidas, int hilos, uint64_t semilla) const {
+  int n = obtenerCantidadParticipantes();
+  if (n < 2 || n > MAXIMO_JUGADORES) {
+    throw std::invalid_argument("El torneo necesita entre 2 y 4 participantes");
+  }
+  if (hilos <= 0) {
+    hilos = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  long lotes = (std::max(0L, partidas) + PARTIDAS_POR_LOTE - 1) / PARTIDAS_POR_LOTE;
+  hilos = static_cast<int>(std::max(1L, std::min<long>(hilos, lotes)));
+
+  std::vector<EstadisticasHilo> porHilo(hilos);
+  std::vector<std::exception_ptr> errores(hilos);
+  std::atomic<long> siguienteLote(0);
+
+  auto trabajar = [&](int t) {
+    try {
+      EstadisticasTorneo &propias = porHilo[t].estadisticas;
+      propias.participantes = n;
+      for (long lote = siguienteLote++; lote < lotes; lote = siguienteLote++) {
+        // Políticas nuevas en cada lote, así el estado que guarden (por ejemplo la
+        // tabla del solucionador) no depende de qué lotes jugó antes este hilo;
+        // un motor por rotación de asientos
+        std::vector<std::unique_ptr<PoliticaDomino>> politicas;
+        for (const FabricaPolitica &fabrica : fabricas) {
+          politicas.push_back(fabrica());
+        }
+        std::vector<MotorDomino> motores;
+        for (int rotacion = 0; rotacion < n; ++rotacion) {
+          std::vector<PoliticaDomino *> asientos;
+          for (int asiento = 0; asiento < n; ++asiento) {
+            asientos.push_back(politicas[(asiento + rotacion) % n].get());
+          }
+          motores.emplace_back(asientos);
+        }
+
+        GeneradorDomino generador(semillaDeLote(semilla, lote));
+        long desde = lote * PARTIDAS_POR_LOTE;
+        long hasta = std::min(partidas, desde + PARTIDAS_POR_LOTE);
+        for (long g = desde; g < hasta; ++g) {
+          int rotacion = static_cast<int>(g % n);
+          ResultadoPartida resultado = motores[rotacion].jugarPartida(generador);
+          int ganador = (resultado.ganador + rotacion) % n;
+          propias.partidas++;
+          propias.trancas += resultado.tranca;
+          propias.jugadas += resultado.jugadas;
+          propias.pases += resultado.pases;
+          propias.victoriasAsiento[resultado.ganador]++;
+          propias.victoriasParticipante[ganador]++;
+          propias.victoriasParticipanteAsiento[ganador][resultado.ganador]++;
+        }
+      }
+    } catch (...) {
+      errores[t] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> trabajadores;
+  for (int t = 1; t < hilos; ++t) {
+    trabajadores.emplace_back(trabajar, t);
+  }
+  trabajar(0);
+  for (std::thread &trabajador : trabajadores) {
+    trabajador.join();
+  }
+  for (const std::exception_ptr &error : errores) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  EstadisticasTorneo total;
+  total.participantes = n;
+  for (const EstadisticasHilo &hilo : porHilo) {
+    total.combinar(hilo.estadisticas);
+  }
+  return total;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file TorneoDomino.h
+ * @brief Torneos Monte Carlo en paralelo sobre MotorDomino.
+ */
+
+#ifndef TORNEO_DOMINO_H
+#define TORNEO_DOMINO_H
+
+#include "MotorDomino.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct EstadisticasTorneo
+ * @brief Conteos de un torneo; las de cada hilo se combinan al final.
+ *
+ * El asiento 0 es el que sale en todas las partidas.
+ */
+struct EstadisticasTorneo {
+  int participantes = 0;
+  long partidas = 0;
+  long trancas = 0;
+  long jugadas = 0;
+  long pases = 0;
+  long victoriasAsiento[MAXIMO_JUGADORES] = {0, 0, 0, 0};
+  long victoriasParticipante[MAXIMO_JUGADORES] = {0, 0, 0, 0};
+  long victoriasParticipanteAsiento[MAXIMO_JUGADORES][MAXIMO_JUGADORES] = {};
+
+  void combinar(const EstadisticasTorneo &otras);
+
+  /// Fracción de victorias (0 si no hubo partidas)
+  double tasaAsiento(int asiento) const;
+  double tasaParticipante(int participante) const;
+
+  /// Semiancho del intervalo de confianza del 95% de una tasa p
+  double margenError(double p) const;
+};
+
+/**
+ * @class TorneoDomino
+ * @brief Juega muchas partidas sin consola entre 2 y 4 participantes, en varios hilos.
+ *
+ * Los participantes rotan de asiento: en la partida g el asiento s lo ocupa el
+ * participante (s + g) % n, así cada uno juega lo mismo en cada asiento y se
+ * pueden separar la ventaja del asiento y la de la estrategia.
+ *
+ * Las partidas se reparten en lotes de PARTIDAS_POR_LOTE que los hilos toman
+ * de un contador atómico (el que termina antes toma el siguiente). Cada lote
+ * tiene su propio GeneradorDomino con semilla derivada de (semilla, lote) y
+ * crea sus propias políticas con las fábricas, así nada pasa de un lote a otro.
+ *
+ * Si cada política elige siempre lo mismo ante el mismo estado y el mismo
+ * generador, el resultado depende solo de la semilla y no de la cantidad de
+ * hilos ni del orden en que se tomaron los lotes. Eso vale para las políticas
+ * golosa y aleatoria y para PoliticaISMCTS con un solo hilo y límite de
+ * iteraciones. No vale para las que cortan por tiempo (PoliticaSolucionador, o
+ * PoliticaISMCTS sin límite de iteraciones, que es su valor por defecto), ni
+ * para PoliticaISMCTS con varios hilos: ahí el resultado depende de la
+ * velocidad de la máquina y de la carga de los hilos.
+ */
+class TorneoDomino {
+public:
+  using FabricaPolitica = std::function<std::unique_ptr<PoliticaDomino>()>;
+
+  static constexpr long PARTIDAS_POR_LOTE = 4096;
+
+private:
+  std::vector<std::string> nombres;
+  std::vector<FabricaPolitica> fabricas;
+
+public:
+  void agregarParticipante(const std::string &nombre, FabricaPolitica fabrica);
+
+  /// Jugar 'partidas' partidas con 'hilos' hilos (0: uno por núcleo).
+  /// Lanza std::invalid_argument si no hay entre 2 y 4 participantes.
+  EstadisticasTorneo jugar(long partidas, int hilos = 0, uint64_t semilla = 1) const;
+
+  int obtenerCantidadParticipantes() const { return static_cast<int>(nombres.size()); }
+  const std::string &obtenerNombre(int participante) const { return nombres[participante]; }
+};
+
+#endif // TORNEO_DOMINO_H
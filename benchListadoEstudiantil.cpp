@@ -0,0 +1,263 @@
+#include "ListadoEstudiantil.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// Benchmark de ListadoEstudiantil con rosters sintéticos de 10^3 a 10^N registros
+// Uso: ./benchListadoEstudiantil [N]   (N = exponente máximo, por defecto 7)
+// Para cada tamaño mide insertar, buscar, operator[] (con y sin huecos), eliminar,
+// invertir y exportar, e informa ns por operación, operaciones por segundo y
+// memoria por registro. Al final muestra cómo crece el costo por operación con n.
+
+namespace {
+
+using Reloj = std::chrono::steady_clock;
+
+const int CONSULTAS = 100000;            // Búsquedas y accesos por tamaño
+const long REGISTROS_POR_MEDICION = 200000; // Mínimo de registros procesados por medición
+const char* ARCHIVO_TEMPORAL = "bench_export.tmp";
+
+const char* NOMBRES[] = {"José", "María", "Ana", "Luis", "Sofía", "Andrés", "Camila", "Jorge"};
+const char* APELLIDOS[] = {"Pérez", "López", "Rodríguez", "González", "Martínez", "Gómez", "Núñez", "Díaz"};
+
+// Memoria del heap en uso (bloques normales más bloques con mmap)
+long memoriaEnUso() {
+#ifdef __GLIBC__
+    struct mallinfo2 info = mallinfo2();
+    return static_cast<long>(info.uordblks + info.hblkhd);
+#else
+    return -1;
+#endif
+}
+
+// IDs dispersos para que el índice hash no vea claves consecutivas
+std::string idDe(long i) {
+    return std::to_string((i * 2654435761L) % 1000000007L);
+}
+
+Estudiante generar(long i) {
+    std::string nombre = std::string(NOMBRES[i % 8]) + " " + APELLIDOS[(i / 8) % 8] + " " + APELLIDOS[(i / 64) % 8];
+    std::string email = "estudiante" + std::to_string(i) + "@universidad.edu";
+    return Estudiante(nombre, 1995 + static_cast<int>(i % 12), idDe(i), 2.0 + (i % 31) / 10.0, email);
+}
+
+double segundosDesde(Reloj::time_point inicio) {
+    return std::chrono::duration<double>(Reloj::now() - inicio).count();
+}
+
+struct Resultado {
+    std::string operacion;
+    double nsPorOperacion;
+};
+
+struct Medicion {
+    long tamanio;
+    double bytesPorRegistro;
+    std::vector<Resultado> resultados;
+};
+
+// Sumidero para que el compilador no descarte las lecturas
+volatile long sumidero = 0;
+
+Medicion medirTamanio(long n, std::mt19937& generador) {
+    Medicion medicion;
+    medicion.tamanio = n;
+    long repeticiones = std::max(1L, REGISTROS_POR_MEDICION / n);
+
+    // La memoria de la lista se mide respecto de este punto, cuando ya no queden datos
+    long memoriaBase = memoriaEnUso();
+    std::vector<Estudiante> datos;
+    datos.reserve(n);
+    for (long i = 0; i < n; i++) {
+        datos.push_back(generar(i));
+    }
+
+    // insertar: las repeticiones previas copian, la última mueve los registros
+    // (así con 10^7 no conviven dos copias del roster)
+    Reloj::time_point inicio = Reloj::now();
+    for (long r = 0; r + 1 < repeticiones; r++) {
+        ListadoEstudiantil temporal;
+        for (const Estudiante& estudiante : datos) {
+            temporal.insertar(estudiante);
+        }
+    }
+    double copias = segundosDesde(inicio);
+    ListadoEstudiantil lista;
+    inicio = Reloj::now();
+    for (Estudiante& estudiante : datos) {
+        lista.insertar(std::move(estudiante));
+    }
+    double ultima = segundosDesde(inicio);
+    medicion.resultados.push_back({"insertar", (copias + ultima) * 1e9 / (double(n) * repeticiones)});
+    datos.clear();
+    datos.shrink_to_fit();
+    long memoriaLista = memoriaEnUso() - memoriaBase;
+    medicion.bytesPorRegistro = memoriaBase < 0 ? -1 : double(memoriaLista) / n;
+
+    std::uniform_int_distribution<long> posicion(0, n - 1);
+    std::vector<std::string> ids;
+    ids.reserve(CONSULTAS);
+    for (int i = 0; i < CONSULTAS; i++) {
+        ids.push_back(idDe(posicion(generador)));
+    }
+
+    // buscar por ID
+    inicio = Reloj::now();
+    long suma = 0;
+    for (const std::string& id : ids) {
+        suma += lista.buscar(id);
+    }
+    medicion.resultados.push_back({"buscar", segundosDesde(inicio) * 1e9 / CONSULTAS});
+
+    // operator[] sin huecos
+    std::vector<int> indices(CONSULTAS);
+    for (int& indice : indices) {
+        indice = static_cast<int>(posicion(generador));
+    }
+    inicio = Reloj::now();
+    for (int indice : indices) {
+        suma += lista[indice].anioNacimiento;
+    }
+    medicion.resultados.push_back({"operator[]", segundosDesde(inicio) * 1e9 / CONSULTAS});
+
+    // invertir (dos veces por repetición para dejar el orden original)
+    inicio = Reloj::now();
+    for (long r = 0; r < repeticiones; r++) {
+        lista.invertir();
+        lista.invertir();
+    }
+    medicion.resultados.push_back({"invertir (por registro)", segundosDesde(inicio) * 1e9 / (2.0 * n * repeticiones)});
+
+    // exportar en cada formato a un archivo temporal
+    const std::pair<const char*, FormatoExportacion> formatos[] = {
+        {"exportar Texto (por registro)", FormatoExportacion::Texto},
+        {"exportar CSV (por registro)", FormatoExportacion::CSV},
+        {"exportar Binario (por registro)", FormatoExportacion::Binario}};
+    for (const auto& formato : formatos) {
+        inicio = Reloj::now();
+        for (long r = 0; r < repeticiones; r++) {
+            lista.exportar(ARCHIVO_TEMPORAL, formato.second);
+        }
+        medicion.resultados.push_back({formato.first, segundosDesde(inicio) * 1e9 / (double(n) * repeticiones)});
+    }
+    std::remove(ARCHIVO_TEMPORAL);
+
+    // eliminar la mitad (hasta CONSULTAS registros), en orden aleatorio
+    long cantidadEliminar = std::min<long>(n / 2, CONSULTAS);
+    std::vector<long> victimas(n);
+    for (long i = 0; i < n; i++) {
+        victimas[i] = i;
+    }
+    std::shuffle(victimas.begin(), victimas.end(), generador);
+    victimas.resize(cantidadEliminar);
+    std::vector<std::string> idsEliminar;
+    idsEliminar.reserve(cantidadEliminar);
+    for (long victima : victimas) {
+        idsEliminar.push_back(idDe(victima));
+    }
+    inicio = Reloj::now();
+    for (const std::string& id : idsEliminar) {
+        suma += lista.eliminar(id);
+    }
+    medicion.resultados.push_back({"eliminar", segundosDesde(inicio) * 1e9 / cantidadEliminar});
+
+    // operator[] con huecos pendientes de compactar (búsqueda en el árbol de Fenwick)
+    std::uniform_int_distribution<int> posicionRestante(0, lista.obtenerTamanio() - 1);
+    for (int& indice : indices) {
+        indice = posicionRestante(generador);
+    }
+    inicio = Reloj::now();
+    for (int indice : indices) {
+        suma += lista[indice].anioNacimiento;
+    }
+    medicion.resultados.push_back({"operator[] con huecos", segundosDesde(inicio) * 1e9 / CONSULTAS});
+
+    sumidero = sumidero + suma;
+    return medicion;
+}
+
+void imprimirMedicion(const Medicion& medicion) {
+    std::cout << "\nn = " << medicion.tamanio;
+    if (medicion.bytesPorRegistro >= 0) {
+        std::cout << "  (memoria: " << std::fixed << std::setprecision(1) << medicion.bytesPorRegistro
+                  << " bytes por registro)";
+    }
+    std::cout << "\n";
+    // setw cuenta bytes y "ó" ocupa dos: 35 bytes son 34 columnas
+    std::cout << "  " << std::left << std::setw(35) << "operación" << std::right << std::setw(12) << "ns/op"
+              << std::setw(16) << "ops/s" << "\n";
+    for (const Resultado& resultado : medicion.resultados) {
+        std::cout << "  " << std::left << std::setw(34) << resultado.operacion << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(12) << resultado.nsPorOperacion << std::setprecision(0)
+                  << std::setw(16) << 1e9 / resultado.nsPorOperacion << "\n";
+    }
+}
+
+// Costo por operación frente a n y exponente k de costo ~ n^k (ajuste log-log
+// por mínimos cuadrados): k cercano a 0 es costo constante, 1 es lineal
+void imprimirEscalamiento(const std::vector<Medicion>& mediciones) {
+    std::cout << "\nEscalamiento (ns/op por tamaño)\n";
+    std::cout << "  " << std::left << std::setw(35) << "operación" << std::right;
+    for (const Medicion& medicion : mediciones) {
+        std::cout << std::setw(10) << ("10^" + std::to_string(static_cast<int>(std::lround(std::log10(medicion.tamanio)))));
+    }
+    std::cout << std::setw(10) << "k" << "\n";
+
+    for (size_t op = 0; op < mediciones[0].resultados.size(); op++) {
+        std::cout << "  " << std::left << std::setw(34) << mediciones[0].resultados[op].operacion << std::right;
+        double sx = 0, sy = 0, sxx = 0, sxy = 0;
+        for (const Medicion& medicion : mediciones) {
+            double ns = medicion.resultados[op].nsPorOperacion;
+            std::cout << std::fixed << std::setprecision(1) << std::setw(10) << ns;
+            double x = std::log10(double(medicion.tamanio));
+            double y = std::log10(std::max(ns, 1e-3));
+            sx += x;
+            sy += y;
+            sxx += x * x;
+            sxy += x * y;
+        }
+        double m = double(mediciones.size());
+        double denominador = m * sxx - sx * sx;
+        double k = denominador > 0 ? (m * sxy - sx * sy) / denominador : 0.0;
+        std::cout << std::setprecision(2) << std::setw(10) << k << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int exponenteMaximo = argc > 1 ? std::atoi(argv[1]) : 7;
+    if (exponenteMaximo < 3 || exponenteMaximo > 8) {
+        std::cerr << "Uso: " << argv[0] << " [exponente máximo entre 3 y 8]\n";
+        return 1;
+    }
+
+    std::cout << "===========================================\n";
+    std::cout << "  BENCHMARK DE LISTADO ESTUDIANTIL\n";
+    std::cout << "===========================================\n";
+    std::cout << "Rosters sintéticos de 10^3 a 10^" << exponenteMaximo << " registros\n";
+
+    std::mt19937 generador(12345);
+    std::vector<Medicion> mediciones;
+    long n = 1;
+    for (int exponente = 0; exponente <= exponenteMaximo; exponente++, n *= 10) {
+        if (exponente < 3) {
+            continue;
+        }
+        mediciones.push_back(medirTamanio(n, generador));
+        imprimirMedicion(mediciones.back());
+        std::cout.flush();
+    }
+    imprimirEscalamiento(mediciones);
+    return 0;
+}
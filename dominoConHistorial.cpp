@@ -4,14 +4,18 @@
  *
  * Modificación del juego punto6.cpp para incluir una lista enlazada que almacena
  * el historial completo de movimientos y lo guarda en un archivo de texto.
+ * Las reglas las aplica MotorDomino y el historial está en HistorialMovimientos;
+ * este archivo es la interfaz de consola.
  */
 
-#include <algorithm>
-#include <ctime>
+#include "HistorialMovimientos.h"
+#include "MotorDomino.h"
+#include "PoliticaISMCTS.h"
+#include <cstdlib>
 #include <deque>
-#include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -44,230 +48,206 @@ public:
   int sumaPuntos() const { return ladoIzquierdo + ladoDerecho; }
 };
 
-// ========== HISTORIAL DE MOVIMIENTOS (LISTA ENLAZADA) ==========
-
-/**
- * @class HistorialMovimientos
- * @brief Lista enlazada simple para almacenar el historial de movimientos del juego.
- */
-class HistorialMovimientos {
-private:
-  struct Nodo {
-    string nombreJugador;
-    string fichaJugada;
-    string estadoTablero;
-    int numeroMovimiento;
-    Nodo* siguiente;
-    
-    Nodo(const string& nombre, const string& ficha, const string& estado, int numMov)
-        : nombreJugador(nombre), fichaJugada(ficha), estadoTablero(estado),
-          numeroMovimiento(numMov), siguiente(nullptr) {}
-  };
-  
-  Nodo* cabeza;
-  Nodo* cola;
-  int contador;
-  
-public:
-  HistorialMovimientos() : cabeza(nullptr), cola(nullptr), contador(0) {}
-  
-  ~HistorialMovimientos() {
-    Nodo* actual = cabeza;
-    while (actual != nullptr) {
-      Nodo* siguiente = actual->siguiente;
-      delete actual;
-      actual = siguiente;
-    }
-  }
-  
-  void agregarMovimiento(const string& nombreJugador, const string& fichaJugada, 
-                        const string& estadoTablero) {
-    contador++;
-    Nodo* nuevoNodo = new Nodo(nombreJugador, fichaJugada, estadoTablero, contador);
-    
-    if (cabeza == nullptr) {
-      cabeza = cola = nuevoNodo;
-    } else {
-      cola->siguiente = nuevoNodo;
-      cola = nuevoNodo;
-    }
-  }
-  
-  void imprimirEnArchivo(const string& nombreArchivo) const {
-    ofstream archivo(nombreArchivo);
-    
-    if (!archivo.is_open()) {
-      cerr << "Error: No se pudo crear el archivo " << nombreArchivo << endl;
-      return;
-    }
-    
-    archivo << "========================================\n";
-    archivo << "   HISTORIAL DE PARTIDA DE DOMINÓ\n";
-    archivo << "========================================\n\n";
-    
-    Nodo* actual = cabeza;
-    while (actual != nullptr) {
-      archivo << "Movimiento #" << actual->numeroMovimiento << "\n";
-      archivo << "----------------------------------------\n";
-      archivo << "Jugador: " << actual->nombreJugador << "\n";
-      archivo << "Ficha jugada: " << actual->fichaJugada << "\n";
-      archivo << "Estado del tablero: " << actual->estadoTablero << "\n\n";
-      
-      actual = actual->siguiente;
-    }
-    
-    archivo << "========================================\n";
-    archivo << "Total de movimientos: " << contador << "\n";
-    archivo << "========================================\n";
-    
-    archivo.close();
-    cout << "✓ Historial guardado en " << nombreArchivo << endl;
-  }
-  
-  void imprimirEnConsola() const {
-    cout << "\n========================================\n";
-    cout << "   HISTORIAL DE MOVIMIENTOS\n";
-    cout << "========================================\n\n";
-    
-    Nodo* actual = cabeza;
-    int mostrados = 0;
-    const int maxMostrar = 10;
-    
-    while (actual != nullptr && mostrados < maxMostrar) {
-      cout << "Mov. #" << actual->numeroMovimiento << ": "
-           << actual->nombreJugador << " jugó " << actual->fichaJugada << "\n";
-      actual = actual->siguiente;
-      mostrados++;
-    }
-    
-    if (contador > maxMostrar) {
-      cout << "... y " << (contador - maxMostrar) << " movimientos más\n";
-    }
-    
-    cout << "\nTotal: " << contador << " movimientos\n";
-    cout << "========================================\n";
-  }
-};
-
-// ================================================================
-
 /**
  * @class Jugador
- * @brief Representa a un jugador en el juego de dominó.
+ * @brief Representa a un jugador en el juego de dominó (la mano la guarda el motor).
  */
 class Jugador {
 private:
   string nombre;
-  vector<Ficha> mano;
   int victorias;
 
 public:
   Jugador(string nombre) : nombre(nombre), victorias(0) {}
 
-  void recibirFicha(const Ficha &ficha) { mano.push_back(ficha); }
+  string getNombre() const { return nombre; }
 
-  void mostrarMano() const {
+  void agregarVictoria() { victorias++; }
+  int getVictorias() const { return victorias; }
+};
+
+/**
+ * @class PoliticaConsola
+ * @brief Jugador humano: muestra la mano y pide ficha y lado por consola.
+ */
+class PoliticaConsola : public PoliticaDomino {
+private:
+  string nombre;
+
+  void mostrarMano(const EstadoDomino &estado) const {
+    int jugador = estado.obtenerTurno();
     cout << "Mano de " << nombre << ":" << endl;
-    for (size_t i = 0; i < mano.size(); ++i) {
-      cout << i + 1 << ". " << mano[i].toString() << " ";
+    for (int i = 0; i < estado.obtenerTamanioMano(jugador); ++i) {
+      cout << i + 1 << ". " << textoFicha(estado.obtenerFichaDeMano(jugador, i)) << " ";
     }
     cout << endl;
   }
 
-  Ficha &getFicha(int indice) { return mano[indice]; }
-
-  void removerFicha(int indice) {
-    if (indice >= 0 && indice < mano.size()) {
-      mano.erase(mano.begin() + indice);
+  static int leerEntero() {
+    int valor;
+    while (!(cin >> valor)) {
+      if (cin.eof()) {
+        cout << "\nFin de la entrada." << endl;
+        exit(0);
+      }
+      cin.clear();
+      cin.ignore(numeric_limits<streamsize>::max(), '\n');
     }
+    return valor;
   }
 
-  bool tieneMovimientoValido(int extremoIzq, int extremoDer) const {
-    if (extremoIzq == -1)
-      return true;
+public:
+  PoliticaConsola(string nombre) : nombre(nombre) {}
+
+  Movimiento elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                    GeneradorDomino &) override {
+    mostrarMano(estado);
+    int jugador = estado.obtenerTurno();
+
+    while (true) {
+      cout << "Seleccione el número de la ficha a jugar (0 para "
+              "cancelar/revisar): ";
+      int seleccion = leerEntero();
 
-    for (const auto &ficha : mano) {
-      if (ficha.getIzquierdo() == extremoIzq ||
-          ficha.getIzquierdo() == extremoDer ||
-          ficha.getDerecho() == extremoIzq ||
-          ficha.getDerecho() == extremoDer) {
-        return true;
+      if (seleccion < 1 || seleccion > estado.obtenerTamanioMano(jugador)) {
+        cout << "Selección inválida." << endl;
+        continue;
       }
-    }
-    return false;
-  }
 
-  int getCantidadFichas() const { return mano.size(); }
+      Movimiento movimiento{static_cast<int8_t>(estado.obtenerFichaDeMano(jugador, seleccion - 1)),
+                            Lado::Izquierda};
+      if (!estado.tableroVacio()) {
+        cout << "Donde desea colocarla? (1: Izquierda, 2: Derecha): ";
+        int lado = leerEntero();
+        if (lado != 1 && lado != 2) {
+          cout << "Movimiento inválido. La ficha no coincide con el lado "
+                  "seleccionado."
+               << endl;
+          continue;
+        }
+        movimiento.lado = lado == 1 ? Lado::Izquierda : Lado::Derecha;
+      }
 
-  int sumaPuntosMano() const {
-    int suma = 0;
-    for (const auto &ficha : mano) {
-      suma += ficha.sumaPuntos();
+      for (const Movimiento &legal : legales) {
+        if (legal == movimiento) {
+          return movimiento;
+        }
+      }
+      cout << "Movimiento inválido. La ficha no coincide con el lado "
+              "seleccionado."
+           << endl;
     }
-    return suma;
   }
+};
 
-  string getNombre() const { return nombre; }
+/**
+ * @class PoliticaAutomatica
+ * @brief Jugador de la computadora: ISMCTS con medio segundo por jugada.
+ */
+class PoliticaAutomatica : public PoliticaISMCTS {
+private:
+  string nombre;
 
-  void agregarVictoria() { victorias++; }
-  int getVictorias() const { return victorias; }
+public:
+  PoliticaAutomatica(string nombre) : PoliticaISMCTS(0.5), nombre(nombre) {}
 
-  void limpiarMano() { mano.clear(); }
+  Movimiento elegir(const EstadoDomino &estado, const ListaMovimientos &legales,
+                    GeneradorDomino &generador) override {
+    Movimiento movimiento = PoliticaISMCTS::elegir(estado, legales, generador);
+    cout << nombre << " juega " << textoFicha(movimiento.ficha) << endl;
+    return movimiento;
+  }
 };
 
 /**
- * @class JuegoDomino
- * @brief Gestiona la lógica y el flujo del juego con historial de movimientos.
+ * @class ObservadorConsola
+ * @brief Muestra la partida en consola (el historial lo anota ObservadorHistorial).
  */
-class JuegoDomino {
+class ObservadorConsola : public ObservadorDomino {
 private:
-  vector<Jugador> jugadores;
-  deque<Ficha> tablero;
-  vector<Ficha> pozo;
-  int turnoActual;
-  HistorialMovimientos historial; // Lista enlazada para el historial
+  const vector<Jugador> &jugadores;
+  deque<Ficha> tablero; // Fichas en el orden y orientación en que se ven
 
-  void generarFichas() {
-    pozo.clear();
-    for (int i = 0; i <= 6; ++i) {
-      for (int j = i; j <= 6; ++j) {
-        pozo.emplace_back(i, j);
-      }
+  string obtenerEstadoTablero() const {
+    if (tablero.empty()) {
+      return "[VACÍO]";
+    }
+
+    string resultado;
+    for (const auto &ficha : tablero) {
+      resultado += ficha.toString();
+    }
+    return resultado;
+  }
+
+public:
+  ObservadorConsola(const vector<Jugador> &jugadores) : jugadores(jugadores) {}
+
+  void mostrarTablero() const {
+    cout << "\n--- Tablero ---" << endl;
+    if (tablero.empty()) {
+      cout << "(Vacío)" << endl;
+    } else {
+      cout << obtenerEstadoTablero() << endl;
     }
+    cout << "---------------" << endl;
   }
 
-  void barajarFichas() {
-    random_device rd;
-    mt19937 g(rd());
-    shuffle(pozo.begin(), pozo.end(), g);
+  void alIniciar(const EstadoDomino &) override {
+    tablero.clear();
+    cout << "\n--- Nueva Partida ---" << endl;
   }
 
-  void repartirFichas() {
-    int fichasPorJugador = 7;
-    int fichaIndex = 0;
+  void alComenzarTurno(const EstadoDomino &estado) override {
+    mostrarTablero();
+    cout << "\nTurno de: " << jugadores[estado.obtenerTurno()].getNombre() << endl;
+  }
 
-    for (auto &jugador : jugadores) {
-      jugador.limpiarMano();
-      for (int i = 0; i < fichasPorJugador && fichaIndex < pozo.size(); ++i) {
-        jugador.recibirFicha(pozo[fichaIndex++]);
-      }
+  void alJugar(const EstadoDomino &, const Jugada &jugada) override {
+    Ficha ficha(PIP_MENOR[jugada.ficha], PIP_MAYOR[jugada.ficha]);
+    if (jugada.volteada) {
+      ficha.voltear();
+    }
+    if (jugada.lado == Lado::Izquierda) {
+      tablero.push_front(ficha);
+    } else {
+      tablero.push_back(ficha);
     }
   }
-  
-  string obtenerEstadoTablero() const {
-    if (tablero.empty()) {
-      return "[VACÍO]";
+
+  void alPasar(const EstadoDomino &, int) override {
+    cout << "No tienes movimientos válidos. Pasas turno." << endl;
+  }
+
+  void alTerminar(const EstadoDomino &, const ResultadoPartida &resultado) override {
+    const string &nombreGanador = jugadores[resultado.ganador].getNombre();
+    if (!resultado.tranca) {
+      cout << "\n¡" << nombreGanador << " ha ganado la partida!" << endl;
+      return;
     }
-    
-    string resultado;
-    for (const auto& ficha : tablero) {
-      resultado += ficha.toString();
+
+    cout << "\n¡Juego cerrado (Tranca)! Nadie puede mover." << endl;
+    cout << "\nPuntajes finales:" << endl;
+    for (size_t i = 0; i < jugadores.size(); ++i) {
+      cout << jugadores[i].getNombre() << ": " << resultado.puntos[i] << " puntos." << endl;
     }
-    return resultado;
+    cout << "¡" << nombreGanador << " gana por tener menos puntos!" << endl;
   }
+};
+
+/**
+ * @class JuegoDomino
+ * @brief Gestiona el flujo del juego con historial de movimientos.
+ */
+class JuegoDomino {
+private:
+  vector<Jugador> jugadores;
+  vector<unique_ptr<PoliticaDomino>> politicas;
+  GeneradorDomino generador;
+  HistorialMovimientos historial; // Lista enlazada para el historial
 
 public:
-  JuegoDomino() : turnoActual(0) {}
+  JuegoDomino() : generador(random_device{}()) {}
 
   void inicializarJuego() {
     int numJugadores;
@@ -286,166 +266,43 @@ public:
       cout << "Nombre del jugador " << i + 1 << ": ";
       getline(cin, nombre);
       jugadores.emplace_back(nombre);
-    }
-  }
 
-  void mostrarTablero() const {
-    cout << "\n--- Tablero ---" << endl;
-    if (tablero.empty()) {
-      cout << "(Vacío)" << endl;
-    } else {
-      for (const auto &ficha : tablero) {
-        cout << ficha.toString();
+      cout << "¿Lo juega la computadora? (s/n): ";
+      string respuesta;
+      getline(cin, respuesta);
+      if (respuesta == "s" || respuesta == "S") {
+        politicas.push_back(make_unique<PoliticaAutomatica>(nombre));
+      } else {
+        politicas.push_back(make_unique<PoliticaConsola>(nombre));
       }
-      cout << endl;
     }
-    cout << "---------------" << endl;
+
+    vector<string> nombres;
+    for (const auto &j : jugadores) {
+      nombres.push_back(j.getNombre());
+    }
+    historial.establecerNombres(nombres);
   }
 
   void jugarPartida() {
-    generarFichas();
-    barajarFichas();
-    repartirFichas();
-    tablero.clear();
-
-    turnoActual = 0;
-    bool juegoTerminado = false;
-    int pasesConsecutivos = 0;
-
-    cout << "\n--- Nueva Partida ---" << endl;
-
-    while (!juegoTerminado) {
-      Jugador &jugadorActual = jugadores[turnoActual];
-      mostrarTablero();
-      cout << "\nTurno de: " << jugadorActual.getNombre() << endl;
-
-      int extremoIzq = tablero.empty() ? -1 : tablero.front().getIzquierdo();
-      int extremoDer = tablero.empty() ? -1 : tablero.back().getDerecho();
-
-      if (jugadorActual.tieneMovimientoValido(extremoIzq, extremoDer)) {
-        pasesConsecutivos = 0;
-        jugadorActual.mostrarMano();
-
-        int seleccion = -1;
-        bool movimientoValido = false;
-
-        while (!movimientoValido) {
-          cout << "Seleccione el número de la ficha a jugar (0 para "
-                  "cancelar/revisar): ";
-          if (!(cin >> seleccion)) {
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            continue;
-          }
-
-          if (seleccion < 1 || seleccion > jugadorActual.getCantidadFichas()) {
-            cout << "Selección inválida." << endl;
-            continue;
-          }
-
-          Ficha &fichaJugada = jugadorActual.getFicha(seleccion - 1);
-          string fichaStr = fichaJugada.toString(); // Guardar antes de modificar
-
-          if (tablero.empty()) {
-            tablero.push_back(fichaJugada);
-            jugadorActual.removerFicha(seleccion - 1);
-            movimientoValido = true;
-            
-            // Registrar movimiento en el historial
-            historial.agregarMovimiento(jugadorActual.getNombre(), 
-                                       fichaStr, obtenerEstadoTablero());
-            
-          } else {
-            cout << "Donde desea colocarla? (1: Izquierda, 2: Derecha): ";
-            int lado;
-            cin >> lado;
-
-            if (lado == 1) { // Izquierda
-              if (fichaJugada.getDerecho() == extremoIzq) {
-                tablero.push_front(fichaJugada);
-                jugadorActual.removerFicha(seleccion - 1);
-                movimientoValido = true;
-              } else if (fichaJugada.getIzquierdo() == extremoIzq) {
-                fichaJugada.voltear();
-                tablero.push_front(fichaJugada);
-                jugadorActual.removerFicha(seleccion - 1);
-                movimientoValido = true;
-              }
-            } else if (lado == 2) { // Derecha
-              if (fichaJugada.getIzquierdo() == extremoDer) {
-                tablero.push_back(fichaJugada);
-                jugadorActual.removerFicha(seleccion - 1);
-                movimientoValido = true;
-              } else if (fichaJugada.getDerecho() == extremoDer) {
-                fichaJugada.voltear();
-                tablero.push_back(fichaJugada);
-                jugadorActual.removerFicha(seleccion - 1);
-                movimientoValido = true;
-              }
-            }
-
-            if (movimientoValido) {
-              // Registrar movimiento en el historial
-              historial.agregarMovimiento(jugadorActual.getNombre(), 
-                                         fichaStr, obtenerEstadoTablero());
-            } else {
-              cout << "Movimiento inválido. La ficha no coincide con el lado "
-                      "seleccionado."
-                   << endl;
-            }
-          }
-        }
-
-        // Verificar si ganó
-        if (jugadorActual.getCantidadFichas() == 0) {
-          cout << "\n¡" << jugadorActual.getNombre() << " ha ganado la partida!"
-               << endl;
-          jugadorActual.agregarVictoria();
-          juegoTerminado = true;
-        }
-
-      } else {
-        cout << "No tienes movimientos válidos. Pasas turno." << endl;
-        pasesConsecutivos++;
-      }
+    vector<PoliticaDomino *> participantes;
+    for (auto &politica : politicas) {
+      participantes.push_back(politica.get());
+    }
+    MotorDomino motor(participantes);
+    ObservadorConsola consola(jugadores);
+    ObservadorHistorial registro(historial);
+    motor.agregarObservador(&consola);
+    motor.agregarObservador(&registro);
 
-      // Verificar cierre (tranca)
-      if (pasesConsecutivos >= jugadores.size()) {
-        cout << "\n¡Juego cerrado (Tranca)! Nadie puede mover." << endl;
-        determinarGanadorPorPuntos();
-        juegoTerminado = true;
-      }
+    ResultadoPartida resultado = motor.jugarPartida(generador);
+    jugadores[resultado.ganador].agregarVictoria();
 
-      turnoActual = (turnoActual + 1) % jugadores.size();
-    }
-    
     // Mostrar historial y guardar en archivo
     historial.imprimirEnConsola();
     historial.imprimirEnArchivo("historial_domino.txt");
   }
 
-  void determinarGanadorPorPuntos() {
-    int minPuntos = numeric_limits<int>::max();
-    int indiceGanador = -1;
-
-    cout << "\nPuntajes finales:" << endl;
-    for (int i = 0; i < jugadores.size(); ++i) {
-      int puntos = jugadores[i].sumaPuntosMano();
-      cout << jugadores[i].getNombre() << ": " << puntos << " puntos." << endl;
-
-      if (puntos < minPuntos) {
-        minPuntos = puntos;
-        indiceGanador = i;
-      }
-    }
-
-    if (indiceGanador != -1) {
-      cout << "¡" << jugadores[indiceGanador].getNombre()
-           << " gana por tener menos puntos!" << endl;
-      jugadores[indiceGanador].agregarVictoria();
-    }
-  }
-
   void run() {
     inicializarJuego();
     bool seguirJugando = true;
@@ -0,0 +1,403 @@
+#include "HistorialMovimientos.h"
+#include "MotorDomino.h"
+#include "PoliticaISMCTS.h"
+#include "ReproductorHistorial.h"
+#include "SolucionadorDomino.h"
+#include "TorneoDomino.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Observador que muestra las jugadas de una partida en una línea cada una
+class ObservadorTexto : public ObservadorDomino {
+public:
+    void alJugar(const EstadoDomino& estado, const Jugada& jugada) override {
+        std::cout << "  Jugador " << int(jugada.jugador) + 1 << " juega " << textoFicha(jugada.ficha, jugada.volteada)
+                  << (jugada.lado == Lado::Izquierda ? " a la izquierda" : " a la derecha") << "  -> extremos "
+                  << estado.obtenerExtremoIzquierdo() << " y " << estado.obtenerExtremoDerecho() << "\n";
+    }
+
+    void alPasar(const EstadoDomino&, int jugador) override {
+        std::cout << "  Jugador " << jugador + 1 << " pasa\n";
+    }
+};
+
+// Observador que guarda el estado al terminar la partida
+class ObservadorFinal : public ObservadorDomino {
+public:
+    EstadoDomino final;
+
+    void alTerminar(const EstadoDomino& estado, const ResultadoPartida&) override {
+        final = estado;
+    }
+};
+
+int main() {
+    std::cout << "\n===========================================\n";
+    std::cout << "  MOTOR DE DOMINÓ (SIN CONSOLA)\n";
+    std::cout << "===========================================\n";
+
+    // 1. Numeración de fichas
+    std::cout << "\n1. Numeración de las 28 fichas:\n  ";
+    for (int ficha = 0; ficha < CANTIDAD_FICHAS; ficha++) {
+        std::cout << ficha << "=" << textoFicha(ficha) << (ficha % 7 == 6 ? "\n  " : " ");
+    }
+    std::cout << "idFicha(5, 2) = " << idFicha(5, 2) << " -> " << textoFicha(idFicha(5, 2)) << "\n";
+
+    // 2. Una partida entre dos políticas, mostrando cada jugada
+    std::cout << "\n2. Partida de ejemplo (golosa contra aleatoria, semilla 7):\n";
+    PoliticaGolosa golosa;
+    PoliticaAleatoria aleatoria;
+    MotorDomino motorEjemplo({&golosa, &aleatoria});
+    ObservadorTexto observador;
+    motorEjemplo.agregarObservador(&observador);
+    GeneradorDomino generadorEjemplo(7);
+    ResultadoPartida ejemplo = motorEjemplo.jugarPartida(generadorEjemplo);
+    std::cout << "  Gana el jugador " << ejemplo.ganador + 1 << (ejemplo.tranca ? " por tranca" : "")
+              << " tras " << ejemplo.jugadas << " jugadas y " << ejemplo.pases << " pases\n";
+
+    // 3. La misma semilla reproduce la misma partida
+    std::cout << "\n3. Reproducibilidad con la misma semilla:\n";
+    MotorDomino motorRepeticion({&golosa, &aleatoria});
+    GeneradorDomino generadorRepeticion(7);
+    ResultadoPartida repeticion = motorRepeticion.jugarPartida(generadorRepeticion);
+    bool igual = repeticion.ganador == ejemplo.ganador && repeticion.jugadas == ejemplo.jugadas &&
+                 repeticion.pases == ejemplo.pases;
+    std::cout << (igual ? "  ✓ Misma partida\n" : "  ✗ La partida cambió\n");
+
+    // 4. Manos dadas y validación de movimientos
+    std::cout << "\n4. Manos dadas y movimientos legales:\n";
+    EstadoDomino estado;
+    estado.repartir({{idFicha(6, 6), idFicha(6, 1)}, {idFicha(1, 2), idFicha(3, 3)}});
+    estado.jugar(Movimiento{static_cast<int8_t>(idFicha(6, 6)), Lado::Izquierda});
+    ListaMovimientos legales;
+    estado.movimientosLegales(legales);
+    std::cout << "  Tablero [6|6]: el jugador 2 tiene " << legales.cantidad << " movimientos legales";
+    std::cout << (legales.vacia() ? " (debe pasar)\n" : "\n");
+    estado.pasar();
+    std::cout << "  Valores que el jugador 2 reveló no tener: ";
+    for (int v = 0; v <= 6; v++) {
+        if (estado.obtenerValoresFaltantes(1) >> v & 1) {
+            std::cout << v << " ";
+        }
+    }
+    std::cout << "\n  [6|1] a la derecha es legal: " << (estado.esLegal({static_cast<int8_t>(idFicha(6, 1)), Lado::Derecha}) ? "sí" : "no")
+              << ", [3|3] no lo tiene el jugador 1: " << (estado.esLegal({static_cast<int8_t>(idFicha(3, 3)), Lado::Derecha}) ? "sí" : "no") << "\n";
+    std::cout << "  Mano del jugador 1 como máscara: 0x" << std::hex << estado.obtenerMano(0) << std::dec
+              << " (" << estado.obtenerTamanioMano(0) << " ficha, " << estado.sumaPuntosMano(0) << " puntos)\n";
+    std::cout << "  Fichas con el valor 6: " << contarFichas(MASCARA_PIP[6]) << ", puntos del juego completo: "
+              << sumaPuntos(TODAS_LAS_FICHAS) << "\n";
+    try {
+        estado.repartir({{0, 1}, {1, 2}});
+        std::cout << "  ✗ Se aceptó una ficha repetida\n";
+    } catch (const std::invalid_argument& e) {
+        std::cout << "  ✓ Manos inválidas rechazadas: " << e.what() << "\n";
+    }
+    try {
+        estado.repartir({{idFicha(6, 6)}, {}});
+        std::cout << "  ✗ Se aceptó una mano vacía\n";
+    } catch (const std::invalid_argument& e) {
+        std::cout << "  ✓ Mano vacía rechazada: " << e.what() << "\n";
+    }
+
+    // 5. Simulación masiva: 4 jugadores golosos contra aleatorios
+    const int PARTIDAS = 200000;
+    std::cout << "\n5. Simulando " << PARTIDAS << " partidas de 4 jugadores (golosa, aleatoria, golosa, aleatoria)...\n";
+    MotorDomino motor({&golosa, &aleatoria, &golosa, &aleatoria});
+    GeneradorDomino generador(2024);
+    int victorias[MAXIMO_JUGADORES] = {0, 0, 0, 0};
+    long jugadas = 0;
+    int trancas = 0;
+    auto inicio = std::chrono::steady_clock::now();
+    for (int i = 0; i < PARTIDAS; i++) {
+        ResultadoPartida resultado = motor.jugarPartida(generador, i % 4);
+        victorias[resultado.ganador]++;
+        jugadas += resultado.jugadas;
+        trancas += resultado.tranca;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  Tiempo: " << segundos << " s (" << std::setprecision(2) << segundos * 1e6 / PARTIDAS
+              << " µs por partida, " << std::setprecision(0) << PARTIDAS / segundos << " partidas/s)\n";
+    std::cout << std::setprecision(1) << "  Jugadas por partida: " << double(jugadas) / PARTIDAS
+              << "  Trancas: " << 100.0 * trancas / PARTIDAS << "%\n";
+    for (int j = 0; j < 4; j++) {
+        std::cout << "  Asiento " << j + 1 << (j % 2 == 0 ? " (golosa):    " : " (aleatoria): ") << 100.0 * victorias[j] / PARTIDAS
+                  << "% de victorias\n";
+    }
+
+    // 6. Torneo en varios hilos: el resultado depende solo de la semilla
+    std::cout << "\n6. Torneo Monte Carlo (golosa contra aleatoria, 2 jugadores, rotando asientos):\n";
+    TorneoDomino torneo;
+    torneo.agregarParticipante("Golosa", [] { return std::make_unique<PoliticaGolosa>(); });
+    torneo.agregarParticipante("Aleatoria", [] { return std::make_unique<PoliticaAleatoria>(); });
+    const long PARTIDAS_TORNEO = 100000;
+    EstadisticasTorneo unHilo = torneo.jugar(PARTIDAS_TORNEO, 1, 99);
+    inicio = std::chrono::steady_clock::now();
+    EstadisticasTorneo variosHilos = torneo.jugar(PARTIDAS_TORNEO, 4, 99);
+    segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << "  " << PARTIDAS_TORNEO << " partidas con 4 hilos en " << std::setprecision(3) << segundos << " s\n";
+    std::cout << std::setprecision(1);
+    for (int i = 0; i < torneo.obtenerCantidadParticipantes(); i++) {
+        double p = variosHilos.tasaParticipante(i);
+        std::cout << "  " << torneo.obtenerNombre(i) << ": " << 100 * p << "% ± " << 100 * variosHilos.margenError(p)
+                  << "% de victorias\n";
+    }
+    std::cout << "  Asiento que sale: " << 100 * variosHilos.tasaAsiento(0) << "% de victorias\n";
+    bool mismoResultado = unHilo.victoriasParticipante[0] == variosHilos.victoriasParticipante[0] &&
+                          unHilo.victoriasAsiento[0] == variosHilos.victoriasAsiento[0] &&
+                          unHilo.jugadas == variosHilos.jugadas;
+    std::cout << (mismoResultado ? "  ✓ Con 1 y 4 hilos se obtienen los mismos conteos\n"
+                                 : "  ✗ Los conteos cambian con la cantidad de hilos\n");
+
+    // 7. Solucionador con todas las manos a la vista
+    std::cout << "\n7. Solucionador con información perfecta:\n";
+    SolucionadorDomino solucionador;
+    GeneradorDomino generadorPosiciones(31);
+    const int jugadoresPorPrueba[] = {2, 4};
+    for (int cantidad : jugadoresPorPrueba) {
+        EstadoDomino posicion;
+        posicion.repartir(cantidad, generadorPosiciones);
+        // Avanzar unas jugadas al azar para llegar a media partida
+        for (int i = 0; i < 2 * cantidad && !posicion.estaTerminado(); i++) {
+            posicion.movimientosLegales(legales);
+            if (legales.vacia()) {
+                posicion.pasar();
+            } else {
+                posicion.jugar(aleatoria.elegir(posicion, legales, generadorPosiciones));
+            }
+        }
+        ResultadoSolucion solucion = solucionador.resolver(posicion, 2.0);
+        std::cout << "  " << cantidad << " jugadores, extremos " << posicion.obtenerExtremoIzquierdo() << " y "
+                  << posicion.obtenerExtremoDerecho() << ", turno del jugador " << posicion.obtenerTurno() + 1 << ": ";
+        if (solucion.hayMovimiento) {
+            std::cout << "jugar " << textoFicha(solucion.mejor.ficha)
+                      << (solucion.mejor.lado == Lado::Izquierda ? " a la izquierda" : " a la derecha");
+        } else {
+            std::cout << "pasar";
+        }
+        std::cout << "\n    " << (solucion.exacto ? (solucion.valor > 0 ? "gana" : "pierde") : "estimación")
+                  << " (valor " << solucion.valor << ", profundidad " << solucion.profundidad << ", "
+                  << solucion.nodos << " nodos, " << std::setprecision(1) << solucion.segundos * 1000 << " ms)\n";
+    }
+
+    // El solucionador (que ve todas las manos) contra la política golosa
+    PoliticaSolucionador perfecta(0.05, 16);
+    MotorDomino motorSolucionador({&perfecta, &golosa});
+    GeneradorDomino generadorSolucionador(5);
+    const int PARTIDAS_SOLUCIONADOR = 200;
+    int victoriasSolucionador = 0;
+    for (int i = 0; i < PARTIDAS_SOLUCIONADOR; i++) {
+        victoriasSolucionador += motorSolucionador.jugarPartida(generadorSolucionador, i % 2).ganador == 0;
+    }
+    std::cout << "  Solucionador contra golosa (2 jugadores, saliendo por turnos): " << victoriasSolucionador << "/"
+              << PARTIDAS_SOLUCIONADOR << " victorias\n";
+
+    // 8. Jugador ISMCTS: solo ve su mano y lo que revelan los pases
+    std::cout << "\n8. Jugador ISMCTS (información imperfecta):\n";
+    EstadoDomino conPases;
+    conPases.repartir({{idFicha(6, 6), idFicha(6, 5), idFicha(0, 0)}, {idFicha(1, 1), idFicha(2, 3), idFicha(4, 4)}});
+    conPases.jugar(Movimiento{static_cast<int8_t>(idFicha(6, 6)), Lado::Izquierda});
+    conPases.pasar(); // El jugador 2 revela que no tiene ningún 6
+    GeneradorDomino generadorMuestras(17);
+    bool respetaPases = true;
+    for (int i = 0; i < 1000; i++) {
+        EstadoDomino muestra = PoliticaISMCTS::determinizar(conPases, generadorMuestras);
+        respetaPases = respetaPases && (muestra.obtenerMano(1) & MASCARA_PIP[6]) == 0 &&
+                       muestra.obtenerTamanioMano(1) == 3 && muestra.obtenerMano(0) == conPases.obtenerMano(0);
+    }
+    std::cout << (respetaPases ? "  ✓ 1000 muestras de manos ocultas respetan los pases\n"
+                               : "  ✗ Alguna muestra contradice un pase\n");
+
+    PoliticaISMCTS porTiempo(0.02, 2);
+    GeneradorDomino generadorBusqueda(23);
+    EstadoDomino inicial;
+    inicial.repartir(4, generadorBusqueda);
+    inicial.movimientosLegales(legales);
+    Movimiento elegido = porTiempo.elegir(inicial, legales, generadorBusqueda);
+    const EstadisticasISMCTS& busqueda = porTiempo.obtenerUltimaBusqueda();
+    std::cout << "  Salida con 20 ms y 2 hilos: " << textoFicha(elegido.ficha) << " (" << busqueda.iteraciones
+              << " iteraciones, " << busqueda.nodos << " nodos, " << std::setprecision(1) << busqueda.segundos * 1000
+              << " ms, victoria estimada " << 100 * busqueda.tasaVictoriaEstimada << "%)\n";
+
+    TorneoDomino contraGolosa;
+    contraGolosa.agregarParticipante("ISMCTS", [] { return std::make_unique<PoliticaISMCTS>(0.0, 1, 500); });
+    contraGolosa.agregarParticipante("Golosa", [] { return std::make_unique<PoliticaGolosa>(); });
+    EstadisticasTorneo resultadoISMCTS = contraGolosa.jugar(200, 1, 7);
+    double tasaISMCTS = resultadoISMCTS.tasaParticipante(0);
+    std::cout << "  ISMCTS (500 iteraciones) contra golosa en 200 partidas: " << 100 * tasaISMCTS << "% ± "
+              << 100 * resultadoISMCTS.margenError(tasaISMCTS) << "% de victorias\n";
+
+    // 9. Historial compacto: 2 bytes por jugada, el tablero se arma al imprimir
+    std::cout << "\n9. Historial compacto de partidas simuladas:\n";
+    const int PARTIDAS_HISTORIAL = 100000;
+    HistorialMovimientos historialMasivo;
+    ObservadorHistorial registroMasivo(historialMasivo);
+    MotorDomino motorHistorial({&golosa, &aleatoria, &golosa, &aleatoria});
+    motorHistorial.agregarObservador(&registroMasivo);
+    GeneradorDomino generadorHistorial(2024);
+    inicio = std::chrono::steady_clock::now();
+    for (int i = 0; i < PARTIDAS_HISTORIAL; i++) {
+        motorHistorial.jugarPartida(generadorHistorial, i % 4);
+    }
+    segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << "  " << PARTIDAS_HISTORIAL << " partidas, " << historialMasivo.obtenerCantidad() << " jugadas en "
+              << std::setprecision(1) << historialMasivo.bytesUsados() / 1048576.0 << " MB ("
+              << std::setprecision(2) << double(historialMasivo.bytesUsados()) / historialMasivo.obtenerCantidad()
+              << " bytes por jugada), " << std::setprecision(3) << segundos << " s\n";
+
+    // El tablero que se arma al escribir el archivo debe terminar en los
+    // extremos reales de la partida (dos partidas seguidas, semilla 7)
+    HistorialMovimientos historialEjemplo;
+    historialEjemplo.establecerNombres({"Golosa", "Aleatoria"});
+    ObservadorHistorial registroEjemplo(historialEjemplo);
+    ObservadorFinal observadorFinal;
+    MotorDomino motorArchivo({&golosa, &aleatoria});
+    motorArchivo.agregarObservador(&registroEjemplo);
+    motorArchivo.agregarObservador(&observadorFinal);
+    GeneradorDomino generadorArchivo(7);
+    motorArchivo.jugarPartida(generadorArchivo);
+    ResultadoPartida segunda = motorArchivo.jugarPartida(generadorArchivo, 1);
+    historialEjemplo.imprimirEnArchivo("historial_prueba.txt");
+    std::ifstream archivoHistorial("historial_prueba.txt");
+    std::string linea;
+    std::string ultimoTablero;
+    while (std::getline(archivoHistorial, linea)) {
+        if (linea.rfind("Estado del tablero: ", 0) == 0) {
+            ultimoTablero = linea.substr(20);
+        }
+    }
+    const EstadoDomino& final = observadorFinal.final;
+    std::string esperadoInicio = "[" + std::to_string(final.obtenerExtremoIzquierdo()) + "|";
+    std::string esperadoFin = "|" + std::to_string(final.obtenerExtremoDerecho()) + "]";
+    bool tableroCorrecto = ultimoTablero.size() == 5u * segunda.jugadas &&
+                           ultimoTablero.compare(0, esperadoInicio.size(), esperadoInicio) == 0 &&
+                           ultimoTablero.compare(ultimoTablero.size() - esperadoFin.size(), esperadoFin.size(), esperadoFin) == 0;
+    std::cout << (tableroCorrecto ? "  ✓ Tablero reconstruido al escribir el archivo: "
+                                  : "  ✗ El tablero reconstruido no coincide: ")
+              << ultimoTablero << "\n";
+
+    // 10. Reproducción: ir a cualquier jugada desde el punto de control anterior
+    std::cout << "\n10. Reproducción de historiales con puntos de control:\n";
+    HistorialMovimientos cargado;
+    int cargadas = cargado.cargarDesdeArchivo("historial_prueba.txt");
+    ReproductorHistorial original(historialEjemplo);
+    ReproductorHistorial reproductor(cargado);
+    bool mismosTableros = cargadas == original.obtenerCantidad();
+    for (int k = 0; mismosTableros && k <= original.obtenerCantidad(); k++) {
+        original.irA(k);
+        reproductor.irA(k);
+        mismosTableros = original.estadoTablero() == reproductor.estadoTablero() &&
+                         (k == 0 || (original.ultimaJugada().jugador == reproductor.ultimaJugada().jugador &&
+                                     original.nombreJugador(original.ultimaJugada().jugador) ==
+                                         reproductor.nombreJugador(reproductor.ultimaJugada().jugador)));
+    }
+    std::cout << (mismosTableros ? "  ✓ " : "  ✗ ") << cargadas << " jugadas cargadas de historial_prueba.txt"
+              << (mismosTableros ? " con los mismos tableros y asientos\n" : ", los tableros o asientos no coinciden\n");
+
+    // Nombre vacío y nombres repetidos: el archivo lleva el asiento y se relee igual
+    HistorialMovimientos historialRepetidos;
+    historialRepetidos.establecerNombres({"", "Ana", "Ana"});
+    ObservadorHistorial registroRepetidos(historialRepetidos);
+    MotorDomino motorRepetidos({&golosa, &aleatoria, &golosa});
+    motorRepetidos.agregarObservador(&registroRepetidos);
+    GeneradorDomino generadorRepetidos(5);
+    motorRepetidos.jugarPartida(generadorRepetidos, 2);
+    historialRepetidos.imprimirEnArchivo("historial_repetidos.txt");
+    HistorialMovimientos releido;
+    releido.cargarDesdeArchivo("historial_repetidos.txt");
+    releido.imprimirEnArchivo("historial_repetidos_2.txt");
+    std::ifstream primero("historial_repetidos.txt");
+    std::ifstream segundo("historial_repetidos_2.txt");
+    std::string textoPrimero((std::istreambuf_iterator<char>(primero)), std::istreambuf_iterator<char>());
+    std::string textoSegundo((std::istreambuf_iterator<char>(segundo)), std::istreambuf_iterator<char>());
+    std::cout << (textoPrimero == textoSegundo ? "  ✓ " : "  ✗ ") << "Jugadores \"\", \"Ana\" y \"Ana\": "
+              << (textoPrimero == textoSegundo ? "el archivo se relee igual" : "el archivo releído cambió")
+              << " (" << releido.obtenerCantidad() << " jugadas)\n";
+
+    // Una partida que abre el segundo asiento: el archivo conserva quién es quién
+    HistorialMovimientos historialSegundo;
+    historialSegundo.establecerNombres({"Golosa", "Aleatoria"});
+    ObservadorHistorial registroSegundo(historialSegundo);
+    MotorDomino motorSegundo({&golosa, &aleatoria});
+    motorSegundo.agregarObservador(&registroSegundo);
+    GeneradorDomino generadorSegundo(3);
+    motorSegundo.jugarPartida(generadorSegundo, 1);
+    historialSegundo.imprimirEnArchivo("historial_segundo.txt");
+    HistorialMovimientos releidoSegundo;
+    releidoSegundo.cargarDesdeArchivo("historial_segundo.txt");
+    ReproductorHistorial reproductorSegundo(releidoSegundo);
+    reproductorSegundo.irA(1);
+    Jugada apertura = reproductorSegundo.ultimaJugada();
+    bool asientoCorrecto = apertura.jugador == 1 && reproductorSegundo.nombreJugador(1) == "Aleatoria";
+    std::cout << (asientoCorrecto ? "  ✓ " : "  ✗ ") << "Partida que abre el asiento 2: la primera jugada es de "
+              << reproductorSegundo.nombreJugador(apertura.jugador) << " (asiento " << apertura.jugador + 1 << ")\n";
+
+    reproductor.irA(5);
+    Jugada quinta = reproductor.ultimaJugada();
+    std::cout << "  Jugada 5 (partida " << reproductor.obtenerPartida() << "): "
+              << reproductor.nombreJugador(quinta.jugador) << " jugó " << textoFicha(quinta.ficha) << " -> "
+              << reproductor.estadoTablero() << "\n";
+    reproductor.retroceder();
+    std::cout << "  Un paso atrás: " << reproductor.estadoTablero() << "\n";
+    reproductor.irA(reproductor.obtenerCantidad());
+    reproductor.retroceder();
+    reproductor.avanzar();
+    std::cout << "  Al final (partida " << reproductor.obtenerPartida() << ", extremos "
+              << reproductor.obtenerExtremoIzquierdo() << " y " << reproductor.obtenerExtremoDerecho() << "): "
+              << reproductor.estadoTablero() << "\n";
+
+    // Partidas retomadas a mitad con jugarDesde: cada una abre su propio tablero
+    HistorialMovimientos historialRetomado;
+    ObservadorHistorial registroRetomado(historialRetomado);
+    MotorDomino motorRetomado({&golosa, &aleatoria});
+    motorRetomado.agregarObservador(&registroRetomado);
+    GeneradorDomino generadorRetomado(11);
+    ListaMovimientos legalesRetomado;
+    int jugadasRetomadas = 0;
+    for (int partida = 0; partida < 2; partida++) {
+        EstadoDomino medio;
+        medio.repartir(2, generadorRetomado);
+        for (int turno = 0; turno < 4; turno++) {
+            medio.movimientosLegales(legalesRetomado);
+            if (legalesRetomado.vacia()) {
+                medio.pasar();
+            } else {
+                medio.jugar(legalesRetomado[0]);
+            }
+        }
+        jugadasRetomadas += motorRetomado.jugarDesde(medio, generadorRetomado).jugadas;
+    }
+    ReproductorHistorial reproductorRetomado(historialRetomado);
+    reproductorRetomado.irA(reproductorRetomado.obtenerCantidad());
+    bool retomadasCorrectas = reproductorRetomado.obtenerPartida() == 2 &&
+                              reproductorRetomado.obtenerCantidad() == jugadasRetomadas;
+    std::cout << (retomadasCorrectas ? "  ✓ " : "  ✗ ") << "Dos partidas retomadas con jugarDesde: "
+              << reproductorRetomado.obtenerCantidad() << " jugadas de " << jugadasRetomadas << " en "
+              << reproductorRetomado.obtenerPartida() << " partidas\n";
+
+    ReproductorHistorial reproductorMasivo(historialMasivo);
+    GeneradorDomino generadorSaltos(3);
+    const int SALTOS = 1000000;
+    long fichasVistas = 0;
+    inicio = std::chrono::steady_clock::now();
+    for (int i = 0; i < SALTOS; i++) {
+        reproductorMasivo.irA(static_cast<int>(generadorSaltos.menorQue(reproductorMasivo.obtenerCantidad() + 1)));
+        fichasVistas += reproductorMasivo.cantidadEnTablero();
+    }
+    segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << "  " << SALTOS << " saltos al azar en " << reproductorMasivo.obtenerCantidad() << " jugadas: "
+              << std::setprecision(0) << segundos * 1e9 / SALTOS << " ns por salto, " << std::setprecision(1)
+              << double(fichasVistas) / SALTOS << " fichas en el tablero en promedio\n";
+    std::cout << "  Puntos de control cada 16 jugadas: " << reproductorMasivo.bytesPuntosControl() / 1048576.0
+              << " MB\n";
+
+    std::cout << "\n===========================================\n";
+    std::cout << "  PRUEBAS DEL MOTOR COMPLETADAS\n";
+    std::cout << "===========================================\n\n";
+    return 0;
+}
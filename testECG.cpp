@@ -25,8 +25,23 @@ int main() {
     std::cout << "\n3. Aplicando filtro digital pasa bajos...\n";
     ecg.aplicarFiltroPasaBajos(0.1); // alpha = 0.1 para suavizado moderado
     
-    // 4. Detectar picos en la señal filtrada
-    std::cout << "\n4. Detectando picos en la señal filtrada...\n";
+    // 4. Estadísticas de la señal filtrada en una sola pasada
+    std::cout << "\n4. Estadísticas de la señal filtrada (una sola pasada, núcleo "
+              << (EstadisticasECG::usaAVX2() ? "AVX2" : "escalar") << "):\n";
+    EstadisticasECG estFiltrada = ecg.calcularEstadisticas(true);
+    std::cout << "  Media: " << estFiltrada.obtenerMedia()
+              << "  Desviación: " << estFiltrada.obtenerDesviacionEstandar() << "\n";
+    std::cout << "  Mediana: " << estFiltrada.obtenerMediana()
+              << "  P95: " << estFiltrada.obtenerCuantil(0.95) << "\n";
+    
+    // Las estadísticas de distintos bloques o registros se combinan sin releer datos
+    EstadisticasECG combinadas = ecg.calcularEstadisticas(false);
+    combinadas.combinar(estFiltrada);
+    std::cout << "  Combinadas (original + filtrada): " << combinadas.obtenerCantidad()
+              << " muestras, media = " << combinadas.obtenerMedia() << "\n";
+    
+    // 5. Detectar picos en la señal filtrada
+    std::cout << "\n5. Detectando picos en la señal filtrada...\n";
     auto picos = ecg.detectarPicos(50.0); // Umbral de 50 para detectar picos R
     
     if (!picos.empty()) {
@@ -39,8 +54,20 @@ int main() {
         }
     }
     
-    // 5. Calcular frecuencia cardíaca
-    std::cout << "\n5. Calculando frecuencia cardíaca...\n";
+    // 6. Segmentar latidos y compararlos con la plantilla promedio
+    std::cout << "\n6. Segmentando latidos y comparando con la plantilla...\n";
+    LatidosECG latidos = ecg.extraerLatidos(20, 40); // 0.1 s antes y 0.2 s después del pico
+    latidos.construirPlantilla();
+    const std::vector<double>& correlaciones = latidos.calcularCorrelaciones();
+    std::cout << "✓ " << latidos.obtenerCantidad() << " latidos de " << latidos.obtenerLongitud()
+              << " muestras (núcleo " << (LatidosECG::usaAVX2() ? "AVX2" : "escalar") << ")\n";
+    for (size_t i = 0; i < correlaciones.size(); i++) {
+        std::cout << "  Latido " << (i+1) << ": correlación = " << correlaciones[i] << "\n";
+    }
+    std::cout << "  Posibles ectópicos (r < 0.9): " << latidos.detectarEctopicos(0.9).size() << "\n";
+    
+    // 7. Calcular frecuencia cardíaca
+    std::cout << "\n7. Calculando frecuencia cardíaca...\n";
     double frecuencia = ecg.calcularFrecuenciaCardiaca();
     
     if (frecuencia > 0) {
@@ -51,10 +78,33 @@ int main() {
         std::cout << "└────────────────────────────────────┘\n";
     }
     
-    // 6. Guardar señales en archivo
-    std::cout << "\n6. Guardando señales en archivo...\n";
+    // 8. Carga asíncrona con doble búfer y filtrado durante la lectura
+    std::cout << "\n8. Cargando de nuevo con doble búfer y filtrado en línea...\n";
+    SeñalECG ecgAsincrona;
+    if (ecgAsincrona.cargarDesdeArchivoAsincrono("ECG.txt", true, 0.1, 4096)) {
+        EstadisticasECG estAsincrona = ecgAsincrona.calcularEstadisticas(true);
+        bool coincide = ecgAsincrona.obtenerTamanio() == ecg.obtenerTamanio() &&
+                        estAsincrona.obtenerMedia() == estFiltrada.obtenerMedia();
+        std::cout << (coincide ? "✓" : "✗") << " Resultado "
+                  << (coincide ? "idéntico" : "distinto") << " a la carga síncrona\n";
+    }
+    
+    // 9. Guardar señales en archivo
+    std::cout << "\n9. Guardando señales en archivo...\n";
     ecg.imprimirEnArchivo("senales_ECG.txt");
     
+    // 10. La misma lógica sobre otra configuración: float con dos canales
+    std::cout << "\n10. Señal genérica SeñalBiomedica<float, 2>...\n";
+    SeñalBiomedica<float, 2> senalDoble;
+    std::vector<double> amplitudes = ecg.obtenerAmplitudes();
+    for (size_t i = 0; i < amplitudes.size(); i++) {
+        float muestra = static_cast<float>(amplitudes[i]);
+        senalDoble.agregarMuestra({muestra, 0.5f * muestra}, static_cast<float>(i * 0.005));
+    }
+    senalDoble.filtrarPasaBajos(0.1);
+    std::cout << "✓ Picos canal 0: " << senalDoble.detectarIndicesPicos(50.0f, 0).size()
+              << ", canal 1: " << senalDoble.detectarIndicesPicos(25.0f, 1).size() << "\n";
+    
     std::cout << "\n===========================================\n";
     std::cout << "  PROCESAMIENTO COMPLETADO\n";
     std::cout << "===========================================\n";
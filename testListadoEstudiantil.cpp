@@ -1,5 +1,19 @@
 #include "ListadoEstudiantil.h"
+#include "ArchivoRoster.h"
+#include "ConsultaEstudiantes.h"
+#include "ListadoEstudiantilCompacto.h"
+#include "ListadoEstudiantilConcurrente.h"
+#include "RosterPersistente.h"
+#include "PoolNodos.h"
+#include "ListadoEstudiantilFragmentado.h"
+#include <algorithm>
+#include <fstream>
+#include <atomic>
+#include <cstdio>
 #include <iostream>
+#include <optional>
+#include <thread>
+#include <vector>
 
 int main() {
     std::cout << "\n===========================================\n";
@@ -75,6 +89,226 @@ int main() {
         std::cout << "✗ Error al guardar: " << e.what() << "\n";
     }
     
+    // Inserción por lote (mueve los registros y reserva capacidad una sola vez)
+    std::cout << "\n10. Inserción por lote...\n";
+    std::vector<Estudiante> nuevos;
+    for (int i = 0; i < 1000; i++) {
+        nuevos.emplace_back("Estudiante " + std::to_string(i), 2000 + i % 6,
+                            std::to_string(2000 + i), 3.0 + (i % 20) / 10.0,
+                            "estudiante" + std::to_string(i) + "@universidad.edu");
+    }
+    ListadoEstudiantil listaLote;
+    listaLote.insertarLote(std::move(nuevos));
+    std::cout << "✓ Se insertaron " << listaLote.obtenerTamanio() << " estudiantes por lote\n";
+    std::cout << "  Estudiante con ID 2500 en posición " << listaLote.buscar("2500") << "\n";
+    
+    // Roster binario y CSV (carga masiva con mmap y from_chars)
+    std::cout << "\n11. Guardando y cargando rosters...\n";
+    try {
+        escribirRosterBinario(listaLote, "roster_estudiantes.bin");
+        ListadoEstudiantil listaBinaria;
+        int cargados = listaBinaria.cargarDesdeBinario("roster_estudiantes.bin");
+        std::cout << "✓ Roster binario: " << cargados << " estudiantes, ID 2500 en posición "
+                  << listaBinaria.buscar("2500") << "\n";
+        
+        std::ofstream csv("roster_estudiantes.csv");
+        csv << CABECERA_CSV_ROSTER << "\n";
+        csv << "\"Pérez, Ana\",2002,3001,4.6,ana.perez@universidad.edu\n";
+        csv << "Luis Gómez,2001,3002,3.9,luis.gomez@universidad.edu\n";
+        csv.close();
+        ListadoEstudiantil listaCSV;
+        cargados = listaCSV.cargarDesdeCSV("roster_estudiantes.csv", 2);
+        std::cout << "✓ Roster CSV: " << cargados << " estudiantes\n";
+        listaCSV.imprimir();
+    } catch (const std::exception& e) {
+        std::cout << "✗ Error con el roster: " << e.what() << "\n";
+    }
+    
+    // Consultas con índices ordenados por promedio y año
+    std::cout << "\n12. Consultas por rango y top-k...\n";
+    listaLote.habilitarIndicesOrdenados();
+    std::cout << "✓ Promedio entre 4.0 y 4.5: " << listaLote.rangoPromedio(4.0, 4.5).size() << " estudiantes\n";
+    std::cout << "✓ Nacidos en 2003: " << listaLote.nacidosEn(2003).size() << " estudiantes\n";
+    std::cout << "✓ Tres mejores promedios:\n";
+    for (const Manejador& manejador : listaLote.mejoresPromedios(3)) {
+        const Estudiante* estudiante = listaLote.obtener(manejador);
+        std::cout << "  " << estudiante->nombreCompleto << " (" << estudiante->promedioAcademico << ")\n";
+    }
+    Estudiante corregido = listaLote[listaLote.buscar("2500")];
+    corregido.promedioAcademico = 5.0;
+    corregido.numeroIdentificacion = "2500-B";
+    listaLote.actualizar("2500", corregido);
+    std::cout << "✓ Tras actualizar el ID 2500: mejor promedio "
+              << listaLote.obtener(listaLote.mejoresPromedios(1).front())->numeroIdentificacion
+              << ", ID 2500-B en posición " << listaLote.buscar("2500-B") << "\n";
+    corregido.numeroIdentificacion = "2500";
+    listaLote.actualizar("2500-B", corregido);
+    
+    // Consulta por columnas: (año >= 2002 y promedio > 3.5) o año == 2000
+    std::cout << "\n13. Consulta por columnas...\n";
+    ConsultaEstudiantes consulta(listaLote);
+    consulta.dondeAnio(Comparacion::MayorIgual, 2002)
+            .dondePromedio(Comparacion::Mayor, 3.5)
+            .o()
+            .dondeAnio(Comparacion::Igual, 2000);
+    std::vector<Estudiante> seleccionados = consulta.ejecutar();
+    std::cout << "✓ " << seleccionados.size() << " estudiantes cumplen la consulta"
+              << (ConsultaEstudiantes::usaAVX2() ? " (AVX2)" : "") << "\n";
+    if (!seleccionados.empty()) {
+        std::cout << "  Primero: " << seleccionados.front().nombreCompleto << "\n";
+    }
+    
+    // Lista compacta: texto en una arena y dominios de email internados
+    std::cout << "\n14. Lista compacta...\n";
+    ListadoEstudiantilCompacto compacta;
+    listaLote.recorrer([&compacta](const Estudiante& estudiante) { compacta.insertar(estudiante); });
+    std::cout << "✓ " << compacta.obtenerTamanio() << " estudiantes, "
+              << compacta.obtenerBytesTexto() << " bytes de texto, "
+              << compacta.obtenerCantidadDominios() << " dominio(s) de email\n";
+    EstudianteVista vista = compacta[compacta.buscar("2500")];
+    std::cout << "  ID 2500: " << vista.nombreCompleto << " <" << vista.email() << ">\n";
+    for (int i = 2000; i < 2500; i += 2) {
+        compacta.eliminar(std::to_string(i));
+    }
+    std::cout << "  Tras eliminar 250: " << compacta.obtenerTamanio() << " estudiantes, ID 2500 en posición "
+              << compacta.buscar("2500") << "\n";
+    
+    // Lectores concurrentes sobre instantáneas mientras un escritor modifica
+    std::cout << "\n15. Lecturas concurrentes...\n";
+    ListadoEstudiantilConcurrente compartida(listaLote);
+    std::atomic<bool> terminar(false);
+    std::atomic<long> fallas(0);
+    std::vector<std::thread> lectores;
+    for (int t = 0; t < 4; t++) {
+        lectores.emplace_back([&]() {
+            ListadoEstudiantilConcurrente::Lector lector(compartida);
+            do {
+                if (lector.buscar("2500") != 500) {
+                    fallas++;
+                }
+            } while (!terminar.load());
+        });
+    }
+    compartida.modificar([](ListadoEstudiantil& lista) {
+        for (int i = 0; i < 100; i++) {
+            lista.insertar(Estudiante("Nuevo " + std::to_string(i), 2004, "N" + std::to_string(i), 4.0,
+                                      "nuevo" + std::to_string(i) + "@universidad.edu"));
+        }
+    });
+    compartida.eliminar("N0");
+    terminar = true;
+    for (std::thread& lector : lectores) {
+        lector.join();
+    }
+    std::cout << "✓ Versión " << compartida.obtenerVersion() << " con "
+              << compartida.obtenerInstantanea()->obtenerTamanio() << " estudiantes\n";
+    std::cout << "  Consultas fallidas de los 4 lectores: " << fallas.load() << "\n";
+    
+    // Exportación en formatos para máquinas
+    std::cout << "\n16. Exportando en CSV y JSON Lines...\n";
+    try {
+        listaLote.exportar("listado_estudiantes.csv", FormatoExportacion::CSV, 2);
+        listaLote.exportar("listado_estudiantes.jsonl", FormatoExportacion::JSONL, 2);
+        std::ifstream jsonl("listado_estudiantes.jsonl");
+        std::string primeraLinea;
+        std::getline(jsonl, primeraLinea);
+        std::cout << "✓ Archivos 'listado_estudiantes.csv' y 'listado_estudiantes.jsonl' generados\n";
+        std::cout << "  " << primeraLinea << "\n";
+        
+        // Un campo con salto de línea y coma va entre comillas y se vuelve a leer igual
+        ListadoEstudiantil conSaltos;
+        conSaltos.insertar(Estudiante("Ana\nPérez, hija", 2002, "7001", 4.6, "ana@universidad.edu"));
+        conSaltos.insertar(Estudiante("Luis Gómez", 2001, "7002", 3.9, "luis@universidad.edu"));
+        conSaltos.exportar("roster_saltos.csv", FormatoExportacion::CSV);
+        std::vector<Estudiante> releidos = leerRosterCSV("roster_saltos.csv");
+        bool iguales = releidos.size() == 2 && releidos[0].nombreCompleto == "Ana\nPérez, hija" &&
+                       releidos[1].numeroIdentificacion == "7002";
+        std::cout << (iguales ? "✓" : "✗") << " CSV con saltos de línea en un campo: "
+                  << releidos.size() << " estudiantes releídos\n";
+    } catch (const std::exception& e) {
+        std::cout << "✗ Error al exportar: " << e.what() << "\n";
+    }
+    
+    // Persistencia: log de escritura anticipada e instantáneas
+    std::cout << "\n17. Roster persistente...\n";
+    try {
+        std::remove("roster_persistente.wal");
+        std::remove("roster_persistente.snapshot");
+        {
+            RosterPersistente roster("roster_persistente");
+            roster.insertar(Estudiante("Ana Pérez", 2002, "9001", 4.6, "ana.perez@universidad.edu"));
+            roster.insertar(Estudiante("Luis Gómez", 2001, "9002", 3.9, "luis.gomez@universidad.edu"));
+            roster.tomarInstantanea();
+            roster.insertar(Estudiante("Marta Ruiz", 2003, "9003", 4.2, "marta.ruiz@universidad.edu"));
+            roster.eliminar("9002");
+        } // Se cierra como si el proceso terminara
+        RosterPersistente recuperado("roster_persistente");
+        std::cout << "✓ Recuperados " << recuperado.obtenerTamanio() << " estudiantes (instantánea + log), "
+                  << "ID 9003 en posición " << recuperado.buscar("9003") << "\n";
+    } catch (const std::exception& e) {
+        std::cout << "✗ Error de persistencia: " << e.what() << "\n";
+    }
+    
+    // Búsqueda por texto sin distinguir mayúsculas ni tildes
+    std::cout << "\n18. Búsqueda por texto...\n";
+    lista.habilitarIndiceTexto();
+    for (const Manejador& manejador : lista.buscarTexto("GONZALEZ")) {
+        std::cout << "✓ 'GONZALEZ': " << lista.obtener(manejador)->nombreCompleto << "\n";
+    }
+    for (const Manejador& manejador : lista.buscarTexto("mar", CampoBusqueda::Nombre, true)) {
+        std::cout << "✓ Nombre con palabra que empieza por 'mar': " << lista.obtener(manejador)->nombreCompleto << "\n";
+    }
+    std::cout << "✓ Emails con 'torres': " << lista.buscarTexto("torres", CampoBusqueda::Email).size() << "\n";
+    Manejador renombrado = lista.buscarTexto("GONZALEZ").front();
+    Estudiante datos = *lista.obtener(renombrado);
+    datos.nombreCompleto = "Beatriz Núñez";
+    lista.actualizar(renombrado, datos);
+    std::cout << "✓ Tras renombrar: 'nunez' da " << lista.buscarTexto("nunez").size()
+              << ", 'gonzalez' da " << lista.buscarTexto("gonzalez", CampoBusqueda::Nombre).size() << "\n";
+    
+    // Nodos de los índices ordenados en un pool compartido
+    std::cout << "\n19. Pool de nodos para los índices...\n";
+    PoolNodos pool;
+    {
+        ListadoEstudiantil conPool(&pool);
+        conPool.habilitarIndicesOrdenados();
+        listaLote.recorrer([&conPool](const Estudiante& estudiante) { conPool.insertar(estudiante); });
+        for (int i = 2000; i < 2500; i++) {
+            conPool.eliminar(std::to_string(i));
+        }
+        std::cout << "✓ " << conPool.obtenerTamanio() << " estudiantes indexados en "
+                  << pool.obtenerCantidadPaginas() << " página(s) de 64 KB\n";
+        ListadoEstudiantil movida(std::move(conPool));
+        std::cout << "✓ Lista movida: " << movida.rangoPromedio(4.0, 4.5).size()
+                  << " con promedio entre 4.0 y 4.5; la original quedó con "
+                  << conPool.obtenerTamanio() << " estudiantes\n";
+    }
+    std::cout << "  Bytes en uso tras destruir la lista: " << pool.obtenerBytesEnUso() << "\n";
+    pool.liberar();
+    
+    // Ingesta en paralelo de varios rosters en fragmentos por hash del ID
+    // (listado_estudiantes.csv repite los IDs del roster binario)
+    std::cout << "\n20. Ingesta fragmentada...\n";
+    try {
+        ListadoEstudiantilFragmentado fragmentado(8);
+        ResultadoIngesta ingesta = fragmentado.ingerirArchivos(
+            {"roster_estudiantes.bin", "roster_estudiantes.csv", "listado_estudiantes.csv"}, 2);
+        std::cout << "✓ " << ingesta.insertados << " estudiantes en " << fragmentado.obtenerCantidadFragmentos()
+                  << " fragmentos, " << ingesta.duplicados.size() << " IDs repetidos rechazados\n";
+        int menor = fragmentado.obtenerTamanioFragmento(0);
+        int mayor = menor;
+        for (int i = 1; i < fragmentado.obtenerCantidadFragmentos(); i++) {
+            menor = std::min(menor, fragmentado.obtenerTamanioFragmento(i));
+            mayor = std::max(mayor, fragmentado.obtenerTamanioFragmento(i));
+        }
+        std::cout << "  Registros por fragmento: entre " << menor << " y " << mayor << "\n";
+        std::optional<Estudiante> encontrado = fragmentado.buscar("2500");
+        std::cout << "  ID 2500: " << (encontrado ? encontrado->nombreCompleto : "no encontrado")
+                  << "; lista fusionada con " << fragmentado.fusionar().obtenerTamanio() << " estudiantes\n";
+    } catch (const std::exception& e) {
+        std::cout << "✗ Error en la ingesta: " << e.what() << "\n";
+    }
+    
     std::cout << "\n===========================================\n";
     std::cout << "  PRUEBA COMPLETADA\n";
     std::cout << "===========================================\n\n";
@@ -0,0 +1,73 @@
+#include "TorneoDomino.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+// Torneo Monte Carlo de dominó entre políticas golosas y aleatorias
+// Uso: ./torneoDomino [partidas] [hilos] [jugadores]
+//      (por defecto 10^7 partidas, un hilo por núcleo y 4 jugadores)
+// Informa el porcentaje de victorias por asiento y por participante, con su
+// intervalo de confianza del 95%, y las partidas por segundo.
+
+int main(int argc, char* argv[]) {
+    long partidas = argc > 1 ? std::atol(argv[1]) : 10000000L;
+    int hilos = argc > 2 ? std::atoi(argv[2]) : 0;
+    int jugadores = argc > 3 ? std::atoi(argv[3]) : 4;
+    if (partidas <= 0 || hilos < 0 || jugadores < 2 || jugadores > MAXIMO_JUGADORES) {
+        std::cerr << "Uso: " << argv[0] << " [partidas > 0] [hilos, 0 = uno por núcleo] [jugadores 2-4]\n";
+        return 1;
+    }
+    if (hilos == 0) {
+        hilos = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    TorneoDomino torneo;
+    for (int i = 0; i < jugadores; i++) {
+        if (i % 2 == 0) {
+            torneo.agregarParticipante("Golosa " + std::to_string(i / 2 + 1),
+                                       [] { return std::make_unique<PoliticaGolosa>(); });
+        } else {
+            torneo.agregarParticipante("Aleatoria " + std::to_string(i / 2 + 1),
+                                       [] { return std::make_unique<PoliticaAleatoria>(); });
+        }
+    }
+
+    std::cout << "===========================================\n";
+    std::cout << "  TORNEO MONTE CARLO DE DOMINÓ\n";
+    std::cout << "===========================================\n";
+    std::cout << partidas << " partidas de " << jugadores << " jugadores con " << hilos << " hilo(s)\n";
+
+    auto inicio = std::chrono::steady_clock::now();
+    EstadisticasTorneo estadisticas = torneo.jugar(partidas, hilos);
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Tiempo: " << segundos << " s  (" << std::setprecision(0) << partidas / segundos
+              << " partidas/s)\n";
+    std::cout << std::setprecision(1) << "Jugadas por partida: " << double(estadisticas.jugadas) / partidas
+              << "  Trancas: " << 100.0 * estadisticas.trancas / partidas << "%\n";
+
+    std::cout << "\nVictorias por asiento (el asiento 1 sale siempre):\n" << std::setprecision(2);
+    for (int s = 0; s < jugadores; s++) {
+        double p = estadisticas.tasaAsiento(s);
+        std::cout << "  Asiento " << s + 1 << ": " << std::setw(6) << 100 * p << "% ± "
+                  << 100 * estadisticas.margenError(p) << "%\n";
+    }
+
+    std::cout << "\nVictorias por participante:\n";
+    for (int i = 0; i < jugadores; i++) {
+        double p = estadisticas.tasaParticipante(i);
+        std::cout << "  " << std::left << std::setw(12) << torneo.obtenerNombre(i) << std::right << std::setw(6)
+                  << 100 * p << "% ± " << 100 * estadisticas.margenError(p) << "%   por asiento:";
+        for (int s = 0; s < jugadores; s++) {
+            // Cada participante ocupa cada asiento en 1/n de las partidas
+            std::cout << std::setw(8) << 100.0 * estadisticas.victoriasParticipanteAsiento[i][s] * jugadores / partidas
+                      << "%";
+        }
+        std::cout << "\n";
+    }
+    return 0;
+}